@@ -0,0 +1,177 @@
+//-*-C++-*-
+
+/*
+  Micro-benchmark of utils::spatial::connected_bounding_boxes (used by
+  pdf_decoder<PAGE>::get_connected_shape_bounding_boxes) on synthetic
+  ruling grids of increasing size: a page of `tables` tables, each with
+  n+1 horizontal and n+1 vertical rulings and a dot per table cell, above
+  a field of 4n x n isolated tick-marks.
+
+  For the smaller sizes, the components are checked against the direct
+  (quadratic) algorithm.
+
+  usage:
+
+    benchmark_shapes.exe [max-rulings-per-table]
+*/
+
+#include <parse.h>
+
+namespace
+{
+  using bbox_type = std::array<double, 4>;
+
+  std::vector<bbox_type> make_ruling_grids(int tables, int n)
+  {
+    std::vector<bbox_type> boxes;
+
+    const double cell = 10.0;
+    const double width = n*cell;
+
+    for(int t=0; t<tables; t++)
+      {
+        const double x0 = (t%4)*(width+50.0);
+        const double y0 = (t/4)*(width+50.0);
+
+        for(int k=0; k<=n; k++)
+          {
+            boxes.push_back({x0, y0+k*cell, x0+width, y0+k*cell}); // horizontal
+            boxes.push_back({x0+k*cell, y0, x0+k*cell, y0+width}); // vertical
+          }
+
+        // dots in the middle of the table cells, they join the table
+        for(int i=0; i<n; i++)
+          {
+            for(int j=0; j<n; j++)
+              {
+                const double cx = x0+(i+0.5)*cell;
+                const double cy = y0+(j+0.5)*cell;
+
+                boxes.push_back({cx-1.0, cy-1.0, cx+1.0, cy+1.0});
+              }
+          }
+      }
+
+    // isolated tick-marks below the tables, each is its own component
+    for(int i=0; i<4*n; i++)
+      {
+        for(int j=0; j<n; j++)
+          {
+            const double cx = i*cell;
+            const double cy = -(j+1)*cell;
+
+            boxes.push_back({cx, cy, cx+2.0, cy});
+          }
+      }
+
+    return boxes;
+  }
+
+  // the direct algorithm, which rescans all boxes while a component grows
+  std::vector<bbox_type> direct_connected_bounding_boxes(const std::vector<bbox_type>& boxes,
+                                                         double tol)
+  {
+    std::vector<bool> consumed(boxes.size(), false);
+    std::vector<bbox_type> result;
+
+    for(size_t i=0; i<boxes.size(); i++)
+      {
+        if(consumed[i]) { continue; }
+
+        consumed[i] = true;
+        bbox_type component = boxes[i];
+
+        bool changed = true;
+        while(changed)
+          {
+            changed = false;
+            for(size_t j=0; j<boxes.size(); j++)
+              {
+                if(consumed[j]) { continue; }
+
+                if(utils::spatial::bbox_overlaps_with_tolerance(component, boxes[j], tol))
+                  {
+                    component = {
+                      std::min(component[0], boxes[j][0]),
+                      std::min(component[1], boxes[j][1]),
+                      std::max(component[2], boxes[j][2]),
+                      std::max(component[3], boxes[j][3])
+                    };
+                    consumed[j] = true;
+                    changed = true;
+                  }
+              }
+          }
+
+        result.push_back(component);
+      }
+
+    return result;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  loguru::g_stderr_verbosity = loguru::Verbosity_WARNING;
+
+  int max_rulings = 256;
+  if(argc==2)
+    {
+      max_rulings = std::stoi(argv[1]);
+    }
+  else if(argc!=1)
+    {
+      LOG_S(ERROR) << "usage: " << argv[0] << " [max-rulings-per-table]";
+      return 1;
+    }
+
+  const int    tables = 8;
+  const double tol    = 0.5;
+
+  // the direct algorithm is only run while it takes a reasonable time
+  const size_t max_direct_boxes = 20000;
+
+  std::cout << std::setw(10) << "rulings"
+            << std::setw(10) << "boxes"
+            << std::setw(12) << "components"
+            << std::setw(14) << "indexed [s]"
+            << std::setw(14) << "direct [s]" << "\n";
+
+  bool success = true;
+  for(int n=4; n<=max_rulings; n*=2)
+    {
+      std::vector<bbox_type> boxes = make_ruling_grids(tables, n);
+
+      utils::timer timer;
+      std::vector<bbox_type> result = utils::spatial::connected_bounding_boxes(boxes, tol);
+      double indexed_time = timer.get_time();
+
+      std::cout << std::setw(10) << 2*(n+1)
+                << std::setw(10) << boxes.size()
+                << std::setw(12) << result.size()
+                << std::setw(14) << std::fixed << std::setprecision(6) << indexed_time;
+
+      if(boxes.size()<=max_direct_boxes)
+        {
+          timer.reset();
+          std::vector<bbox_type> direct = direct_connected_bounding_boxes(boxes, tol);
+          double direct_time = timer.get_time();
+
+          std::cout << std::setw(14) << direct_time;
+
+          if(direct!=result)
+            {
+              std::cout << "  MISMATCH";
+              success = false;
+            }
+        }
+      else
+        {
+          std::cout << std::setw(14) << "-";
+        }
+
+      std::cout << "\n";
+    }
+
+  return success? 0 : 1;
+}
@@ -0,0 +1,83 @@
+//-*-C++-*-
+
+/*
+  Compiles the text resources in pdf_resources into the binary files that
+  are memory-mapped at runtime:
+
+   - cmap-resources.bin : the Adobe cmap-resources (see font_cid_table)
+   - font-resources.bin : glyphs, encodings and base-fonts (see font_resources)
+
+  usage:
+
+    compile_resources.exe <pdf-resources-dir> [<output-dir>]
+
+  The tables are written into <output-dir> (default: <pdf-resources-dir>).
+*/
+
+#include <parse.h>
+
+int main(int argc, char *argv[])
+{
+  std::string resources_dir = "../docling_parse/pdf_resources/";
+
+  loguru::g_stderr_verbosity = loguru::Verbosity_WARNING;
+
+  if(argc==2 or argc==3)
+    {
+      resources_dir = argv[1];
+    }
+  else if(argc!=1)
+    {
+      LOG_S(ERROR) << "usage: " << argv[0] << " <pdf-resources-dir> [<output-dir>]";
+      return 1;
+    }
+
+  resources_dir += (resources_dir.back()=='/'? "" : "/");
+
+  std::string output_dir = (argc==3)? argv[2] : resources_dir;
+  output_dir += (output_dir.back()=='/'? "" : "/");
+
+  std::string cmap_table = output_dir+"cmap-resources.bin";
+  std::string font_table = output_dir+"font-resources.bin";
+
+  // the tables are compiled from the text files, do not pick up old ones
+  for(auto filename:{cmap_table, font_table})
+    {
+      if(utils::filesystem::is_file(filename))
+        {
+          std::filesystem::remove(filename);
+        }
+    }
+
+  try
+    {
+      pdflib::font_cids cids;
+      cids.initialise(resources_dir+"cmap-resources/");
+
+      if(not cids.compile(cmap_table))
+        {
+          return 1;
+        }
+
+      pdflib::font_glyphs glyphs;
+      glyphs.initialise(resources_dir+"glyphs/");
+
+      pdflib::font_encodings encodings;
+      encodings.initialise(resources_dir+"encodings/", glyphs);
+
+      pdflib::base_fonts bfonts;
+      bfonts.initialise(resources_dir+"fonts/", glyphs);
+
+      if(not pdflib::font_resources::write(font_table, glyphs, encodings, bfonts))
+        {
+          return 1;
+        }
+    }
+  catch(std::exception const& exc)
+    {
+      LOG_S(ERROR) << exc.what();
+      return 1;
+    }
+
+  return 0;
+}
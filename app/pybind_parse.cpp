@@ -300,6 +300,87 @@ namespace
       artifacts.append(row);
     }
   };
+
+  // Read-only view on one column of a page_cell_columns/page_shape_columns,
+  // exposed through the buffer protocol. It keeps the columns alive, so
+  // memoryview/numpy.asarray on it does not copy.
+  struct column_view
+  {
+    std::shared_ptr<const void> owner;
+
+    const void*       ptr;
+    pybind11::ssize_t itemsize;
+    std::string       format;
+
+    std::vector<pybind11::ssize_t> shape;
+  };
+
+  template<typename T>
+  column_view make_column_view(std::shared_ptr<const void> owner,
+                               const T* data, size_t size, pybind11::ssize_t width)
+  {
+    // an empty vector may have no storage, the buffer needs a valid pointer
+    static const T empty_data = T();
+
+    column_view view;
+    view.owner    = owner;
+    view.ptr      = (size>0)? static_cast<const void*>(data) : static_cast<const void*>(&empty_data);
+    view.itemsize = sizeof(T);
+    view.format   = pybind11::format_descriptor<T>::format();
+
+    view.shape = {static_cast<pybind11::ssize_t>(size)/width};
+    if(width>1)
+      {
+        view.shape.push_back(width);
+      }
+
+    return view;
+  }
+
+  template<typename T, typename columns_type>
+  auto column_getter(std::vector<T> columns_type::*member, pybind11::ssize_t width=1)
+  {
+    return [member, width](std::shared_ptr<columns_type> self) -> column_view {
+      const std::vector<T>& column = (*self).*member;
+      return make_column_view(self, column.data(), column.size(), width);
+    };
+  }
+
+  // load_documents of the threaded parser/renderer: a source is a filename
+  // (str) or the document data (bytes). The sources are converted with the
+  // GIL, the documents are loaded without it.
+  template<typename threaded_type>
+  std::vector<std::string> load_threaded_documents(threaded_type& self,
+                                                   const std::vector<std::string>& keys,
+                                                   const pybind11::list& sources,
+                                                   std::optional<std::string>& password,
+                                                   std::optional<std::vector<int>>& page_numbers)
+  {
+    if(keys.size() != sources.size())
+      {
+        throw std::invalid_argument("keys and sources must have the same length");
+      }
+
+    std::vector<docling::threaded_document_source> documents(keys.size());
+    for(size_t i = 0; i < keys.size(); i++)
+      {
+        documents[i].key = keys[i];
+        documents[i].password = password;
+        documents[i].page_numbers = page_numbers;
+
+        if(pybind11::isinstance<pybind11::bytes>(sources[i]))
+          {
+            documents[i].buffer = std::make_shared<std::string>(sources[i].cast<std::string>());
+          }
+        else
+          {
+            documents[i].filename = sources[i].cast<std::string>();
+          }
+      }
+
+    pybind11::gil_scoped_release release;
+    return self.load_documents(documents);
+  }
 }
 
 PYBIND11_MODULE(pdf_parsers, m) {
@@ -331,6 +412,7 @@ PYBIND11_MODULE(pdf_parsers, m) {
     .def_readwrite("max_num_lines", &pdflib::decode_config::max_num_lines)
     .def_readwrite("max_num_bitmaps", &pdflib::decode_config::max_num_bitmaps)
     .def_readwrite("min_visible_clip_extent", &pdflib::decode_config::min_visible_clip_extent)
+    .def_readwrite("bitmap_decode_scale", &pdflib::decode_config::bitmap_decode_scale)
     .def_readwrite("create_word_cells", &pdflib::decode_config::create_word_cells)
     .def_readwrite("create_line_cells", &pdflib::decode_config::create_line_cells)
     .def_readwrite("enforce_same_font", &pdflib::decode_config::enforce_same_font)
@@ -343,6 +425,7 @@ PYBIND11_MODULE(pdf_parsers, m) {
     .def_readwrite("keep_glyphs", &pdflib::decode_config::keep_glyphs)
     .def_readwrite("keep_qpdf_warnings", &pdflib::decode_config::keep_qpdf_warnings)
     .def_readwrite("extract_font_programs", &pdflib::decode_config::extract_font_programs)
+    .def_readwrite("native_content_lexer", &pdflib::decode_config::native_content_lexer)
     .def("__copy__", [](const pdflib::decode_config& self) { return self; })
     .def("__deepcopy__", [](const pdflib::decode_config& self, pybind11::dict) { return self; });
 
@@ -365,10 +448,10 @@ PYBIND11_MODULE(pdf_parsers, m) {
     .def_readonly("text", &pdflib::page_item<pdflib::PAGE_CELL>::text)
     .def_readonly("rendering_mode", &pdflib::page_item<pdflib::PAGE_CELL>::rendering_mode)
     .def_readonly("space_width", &pdflib::page_item<pdflib::PAGE_CELL>::space_width)
-    .def_readonly("enc_name", &pdflib::page_item<pdflib::PAGE_CELL>::enc_name)
-    .def_readonly("font_enc", &pdflib::page_item<pdflib::PAGE_CELL>::font_enc)
-    .def_readonly("font_key", &pdflib::page_item<pdflib::PAGE_CELL>::font_key)
-    .def_readonly("font_name", &pdflib::page_item<pdflib::PAGE_CELL>::font_name)
+    .def_property_readonly("enc_name", &pdflib::page_item<pdflib::PAGE_CELL>::get_enc_name)
+    .def_property_readonly("font_enc", &pdflib::page_item<pdflib::PAGE_CELL>::get_font_enc)
+    .def_property_readonly("font_key", &pdflib::page_item<pdflib::PAGE_CELL>::get_font_key)
+    .def_property_readonly("font_name", &pdflib::page_item<pdflib::PAGE_CELL>::get_font_name)
     .def_readonly("widget", &pdflib::page_item<pdflib::PAGE_CELL>::widget)
     .def_readonly("left_to_right", &pdflib::page_item<pdflib::PAGE_CELL>::left_to_right);
 
@@ -476,7 +559,69 @@ PYBIND11_MODULE(pdf_parsers, m) {
 	 }, pybind11::return_value_policy::reference_internal)
     .def("__iter__", [](pdflib::page_item<pdflib::PAGE_CELLS>& self) {
 	   return pybind11::make_iterator(self.begin(), self.end());
-	 }, pybind11::keep_alive<0, 1>());
+	 }, pybind11::keep_alive<0, 1>())
+    .def("to_columns", [](pdflib::page_item<pdflib::PAGE_CELLS>& self) {
+	   return std::make_shared<pdflib::page_cell_columns>(self);
+	 }, pybind11::call_guard<pybind11::gil_scoped_release>(),
+	 "Copy the cells into contiguous columns (PdfCellColumns)");
+
+  // ============= Columnar Bindings (buffer protocol) =============
+
+  pybind11::class_<column_view>(m, "PdfColumn", pybind11::buffer_protocol())
+    .def_buffer([](column_view& self) -> pybind11::buffer_info {
+	   std::vector<pybind11::ssize_t> strides(self.shape.size(), self.itemsize);
+	   for(int k=static_cast<int>(self.shape.size())-2; k>=0; k--)
+	     {
+	       strides[k] = strides[k+1]*self.shape[k+1];
+	     }
+
+	   return pybind11::buffer_info(const_cast<void*>(self.ptr), self.itemsize, self.format,
+					self.shape.size(), self.shape, strides, true);
+	 })
+    .def("__len__", [](const column_view& self) { return self.shape.at(0); });
+
+  // PdfCellColumns - cells as contiguous columns (see page_cell_columns)
+  pybind11::class_<pdflib::page_cell_columns, std::shared_ptr<pdflib::page_cell_columns>>(m, "PdfCellColumns")
+    .def("__len__", &pdflib::page_cell_columns::size)
+    .def_readonly_static("FLAG_LEFT_TO_RIGHT", &pdflib::page_cell_columns::FLAG_LEFT_TO_RIGHT)
+    .def_readonly_static("FLAG_WIDGET", &pdflib::page_cell_columns::FLAG_WIDGET)
+    .def_property_readonly("rect", column_getter(&pdflib::page_cell_columns::rect, 8),
+			   "float64[n, 8]: r_x0, r_y0, r_x1, r_y1, r_x2, r_y2, r_x3, r_y3")
+    .def_property_readonly("font_ids", column_getter(&pdflib::page_cell_columns::font_ids),
+			   "int32[n]: index in font_keys/font_names")
+    .def_property_readonly("rendering_mode", column_getter(&pdflib::page_cell_columns::rendering_mode))
+    .def_property_readonly("flags", column_getter(&pdflib::page_cell_columns::flags),
+			   "uint8[n]: FLAG_LEFT_TO_RIGHT | FLAG_WIDGET")
+    .def_property_readonly("text", [](std::shared_ptr<pdflib::page_cell_columns> self) {
+	   return make_column_view(self, reinterpret_cast<const uint8_t*>(self->text.data()),
+				   self->text.size(), 1);
+	 }, "uint8[m]: UTF-8 text of all cells")
+    .def_property_readonly("text_offsets", column_getter(&pdflib::page_cell_columns::text_offsets),
+			   "int64[n+1]: text of cell i is text[text_offsets[i]:text_offsets[i+1]]")
+    .def_readonly("font_keys", &pdflib::page_cell_columns::font_keys)
+    .def_readonly("font_names", &pdflib::page_cell_columns::font_names);
+
+  // PdfShapeColumns - shapes as contiguous columns (see page_shape_columns)
+  pybind11::class_<pdflib::page_shape_columns, std::shared_ptr<pdflib::page_shape_columns>>(m, "PdfShapeColumns")
+    .def("__len__", &pdflib::page_shape_columns::size)
+    .def_property_readonly("x", column_getter(&pdflib::page_shape_columns::x))
+    .def_property_readonly("y", column_getter(&pdflib::page_shape_columns::y))
+    .def_property_readonly("point_offsets", column_getter(&pdflib::page_shape_columns::point_offsets),
+			   "int64[n+1]: points of shape i are x/y[point_offsets[i]:point_offsets[i+1]]")
+    .def_property_readonly("i", column_getter(&pdflib::page_shape_columns::i))
+    .def_property_readonly("index_offsets", column_getter(&pdflib::page_shape_columns::index_offsets),
+			   "int64[n+1]: get_i() of shape i is i[index_offsets[i]:index_offsets[i+1]]")
+    .def_property_readonly("has_graphics_state", column_getter(&pdflib::page_shape_columns::has_graphics_state))
+    .def_property_readonly("line_width", column_getter(&pdflib::page_shape_columns::line_width))
+    .def_property_readonly("miter_limit", column_getter(&pdflib::page_shape_columns::miter_limit))
+    .def_property_readonly("line_cap", column_getter(&pdflib::page_shape_columns::line_cap))
+    .def_property_readonly("line_join", column_getter(&pdflib::page_shape_columns::line_join))
+    .def_property_readonly("dash_phase", column_getter(&pdflib::page_shape_columns::dash_phase))
+    .def_property_readonly("flatness", column_getter(&pdflib::page_shape_columns::flatness))
+    .def_property_readonly("dash_array", column_getter(&pdflib::page_shape_columns::dash_array))
+    .def_property_readonly("dash_offsets", column_getter(&pdflib::page_shape_columns::dash_offsets))
+    .def_property_readonly("rgb_stroking", column_getter(&pdflib::page_shape_columns::rgb_stroking, 3))
+    .def_property_readonly("rgb_filling", column_getter(&pdflib::page_shape_columns::rgb_filling, 3));
 
   // PdfShapes - iterable container of PdfShape objects
   pybind11::class_<pdflib::page_item<pdflib::PAGE_SHAPES>>(m, "PdfShapes")
@@ -490,7 +635,11 @@ PYBIND11_MODULE(pdf_parsers, m) {
 	 }, pybind11::return_value_policy::reference_internal)
     .def("__iter__", [](pdflib::page_item<pdflib::PAGE_SHAPES>& self) {
 	   return pybind11::make_iterator(self.begin(), self.end());
-	 }, pybind11::keep_alive<0, 1>());
+	 }, pybind11::keep_alive<0, 1>())
+    .def("to_columns", [](pdflib::page_item<pdflib::PAGE_SHAPES>& self) {
+	   return std::make_shared<pdflib::page_shape_columns>(self);
+	 }, pybind11::call_guard<pybind11::gil_scoped_release>(),
+	 "Copy the shapes into contiguous columns (PdfShapeColumns)");
 
   // PdfImages - iterable container of PdfImage objects
   pybind11::class_<pdflib::page_item<pdflib::PAGE_IMAGES>>(m, "PdfImages")
@@ -575,11 +724,37 @@ PYBIND11_MODULE(pdf_parsers, m) {
          pybind11::arg("shapes") = true,
          pybind11::arg("bitmaps") = true,
          "Check whether visible chars, shapes, or bitmaps intersect [left, bottom, right, top]")
+    .def("intersects_with_bboxes", &pdflib::pdf_decoder<pdflib::PAGE>::intersects_with_bboxes,
+         pybind11::arg("bboxes"),
+         pybind11::arg("chars") = false,
+         pybind11::arg("shapes") = true,
+         pybind11::arg("bitmaps") = true,
+         pybind11::call_guard<pybind11::gil_scoped_release>(),
+         "Check for each [left, bottom, right, top] bbox whether visible chars, shapes, or bitmaps intersect it")
+    .def("get_cells_in_bbox", &pdflib::pdf_decoder<pdflib::PAGE>::get_cells_in_bbox,
+         pybind11::arg("bbox"),
+         pybind11::arg("cell_unit") = "word",
+         pybind11::arg("contained") = false,
+         pybind11::call_guard<pybind11::gil_scoped_release>(),
+         "Return the indices of the char, word or line cells that intersect (or lie within) [left, bottom, right, top]")
+    .def("get_cells_in_bboxes", &pdflib::pdf_decoder<pdflib::PAGE>::get_cells_in_bboxes,
+         pybind11::arg("bboxes"),
+         pybind11::arg("cell_unit") = "word",
+         pybind11::arg("contained") = false,
+         pybind11::call_guard<pybind11::gil_scoped_release>(),
+         "Return for each [left, bottom, right, top] bbox the indices of the cells that intersect (or lie within) it")
     .def("get_shape_lines", &pdflib::pdf_decoder<pdflib::PAGE>::get_shape_lines,
          pybind11::arg("horizontal") = true,
          pybind11::arg("vertical") = true,
          pybind11::arg("tolerance") = 1e-3,
          "Return visible horizontal and/or vertical stroked shape segments as [left, bottom, right, top]")
+    .def("get_shape_lines_in_bbox", &pdflib::pdf_decoder<pdflib::PAGE>::get_shape_lines_in_bbox,
+         pybind11::arg("bbox"),
+         pybind11::arg("horizontal") = true,
+         pybind11::arg("vertical") = true,
+         pybind11::arg("tolerance") = 1e-3,
+         pybind11::call_guard<pybind11::gil_scoped_release>(),
+         "Return the visible stroked shape segments that touch [left, bottom, right, top]")
     .def("get_connected_shape_bounding_boxes",
          &pdflib::pdf_decoder<pdflib::PAGE>::get_connected_shape_bounding_boxes,
          pybind11::arg("tolerance") = 0.0,
@@ -659,6 +834,8 @@ PYBIND11_MODULE(pdf_parsers, m) {
   m.attr("TIMING_KEY_CREATE_WORD_CELLS") = pdflib::pdf_timings::KEY_CREATE_WORD_CELLS;
   m.attr("TIMING_KEY_CREATE_LINE_CELLS") = pdflib::pdf_timings::KEY_CREATE_LINE_CELLS;
   m.attr("TIMING_KEY_DECODE_FONTS_TOTAL") = pdflib::pdf_timings::KEY_DECODE_FONTS_TOTAL;
+  m.attr("TIMING_KEY_FONT_CACHE_HIT") = pdflib::pdf_timings::KEY_FONT_CACHE_HIT;
+  m.attr("TIMING_KEY_FONT_CACHE_MISS") = pdflib::pdf_timings::KEY_FONT_CACHE_MISS;
   m.attr("TIMING_KEY_DECODE_XOBJECTS_TOTAL") = pdflib::pdf_timings::KEY_DECODE_XOBJECTS_TOTAL;
   m.attr("TIMING_KEY_DECODE_GRPHS_TOTAL") = pdflib::pdf_timings::KEY_DECODE_GRPHS_TOTAL;
 
@@ -876,6 +1053,21 @@ PYBIND11_MODULE(pdf_parsers, m) {
 
     Returns:
         dict: A None or string of the metadata in xml of the document.)")
+
+    .def("get_document_timings",
+	 [](docling::docling_parser &self, const std::string &key) {
+	   return self.get_document_timings(key);
+	 },
+	 pybind11::arg("key"),
+	 R"(
+    Retrieve the timings of the document decoder: loading and the lazy
+    extraction of the annotations, metadata and table of contents.
+
+    Parameters:
+        key (str): The unique key of the document.
+
+    Returns:
+        Dict[str, List[float]]: The recorded durations (seconds) per timing key.)")
     
     .def("get_page_decoder",
 	 [](docling::docling_parser &self,
@@ -887,16 +1079,45 @@ PYBIND11_MODULE(pdf_parsers, m) {
 	 pybind11::arg("key"),
 	 pybind11::arg("page"),
 	 pybind11::arg("config"),
+	 pybind11::call_guard<pybind11::gil_scoped_release>(),
 	 R"(
     Get a typed page decoder using a DecodePageConfig object.
 
+    The page is decoded without holding the GIL. If the page is being
+    prefetched, this waits for that decode.
+
     Parameters:
         key (str): The unique key of the document.
         page (int): The page number to parse (0-indexed).
         config (DecodePageConfig): Configuration object for page decoding.
 
     Returns:
-        PdfPageDecoder: A typed page decoder object.)");
+        PdfPageDecoder: A typed page decoder object.)")
+
+    .def("prefetch_pages",
+	 [](docling::docling_parser &self,
+	    const std::string &key,
+	    const std::vector<int> &pages,
+	    const pdflib::decode_config &config) -> bool {
+	   return self.prefetch_pages(key, pages, config);
+	 },
+	 pybind11::arg("key"),
+	 pybind11::arg("pages"),
+	 pybind11::arg("config"),
+	 pybind11::call_guard<pybind11::gil_scoped_release>(),
+	 R"(
+    Decode pages in the background into the page-decoder cache.
+
+    Returns immediately; get_page_decoder picks up the decoded pages (or
+    waits for the ones in progress).
+
+    Parameters:
+        key (str): The unique key of the document.
+        pages (List[int]): The page numbers to decode (0-indexed).
+        config (DecodePageConfig): Configuration object for page decoding.
+
+    Returns:
+        bool: False if the document is not loaded.)");
 
   // ============= Threaded PDF Parser =============
 
@@ -904,6 +1125,7 @@ PYBIND11_MODULE(pdf_parsers, m) {
     R"(
     Top-level timing breakdown for a threaded page decode task.
     )")
+    .def_readonly("open_document_s", &docling::page_decode_timings::open_document_s)
     .def_readonly("make_page_decoder_s", &docling::page_decode_timings::make_page_decoder_s)
     .def_readonly("decode_page_s", &docling::page_decode_timings::decode_page_s)
     .def_readonly("create_word_cells_s", &docling::page_decode_timings::create_word_cells_s)
@@ -919,7 +1141,9 @@ PYBIND11_MODULE(pdf_parsers, m) {
   pybind11::class_<docling::page_task_result>(m, "_PageTaskResult")
     .def_readonly("doc_key", &docling::page_task_result::doc_key)
     .def_readonly("page_number", &docling::page_task_result::page_number)
-    .def_readonly("success", &docling::page_task_result::success);
+    .def_readonly("success", &docling::page_task_result::success)
+    .def_readonly("document_completed", &docling::page_task_result::document_completed)
+    .def_readonly("memory_bytes", &docling::page_task_result::memory_bytes);
 
   // _PageDecodeResult - internal result of a threaded page decode task
   pybind11::class_<docling::page_decode_result, docling::page_task_result>(m, "_PageDecodeResult",
@@ -967,11 +1191,14 @@ PYBIND11_MODULE(pdf_parsers, m) {
     Loads multiple documents and decodes their pages using a thread pool.
     Results are available via a bounded queue to control memory usage.
     )")
-    .def(pybind11::init<const std::string&, int, int, pdflib::decode_config>(),
+    .def(pybind11::init<const std::string&, int, int, pdflib::decode_config, bool, const std::string&, int64_t>(),
          pybind11::arg("loglevel") = "fatal",
          pybind11::arg("num_threads") = 4,
          pybind11::arg("max_concurrent_results") = 32,
          pybind11::arg("config") = pdflib::decode_config(),
+         pybind11::arg("unload_completed_documents") = false,
+         pybind11::arg("scheduling") = "fifo",
+         pybind11::arg("max_result_bytes") = 0,
          R"(
     Construct a threaded PDF parser.
 
@@ -979,7 +1206,11 @@ PYBIND11_MODULE(pdf_parsers, m) {
         loglevel (str): Logging level ('fatal', 'error', 'warning', 'info').
         num_threads (int): Number of worker threads.
         max_concurrent_results (int): Maximum results buffered before workers pause.
-        config (DecodePageConfig): Configuration for page decoding.)")
+        config (DecodePageConfig): Configuration for page decoding.
+        unload_completed_documents (bool): Unload a document once the result of its last page is consumed.
+        scheduling (str): Page order, 'fifo' or 'longest_first' (by estimated decode cost).
+        max_result_bytes (int): Budget on the estimated bytes of the buffered results (0: no budget);
+            workers pause while the buffered results hold at least this much.)")
 
     .def("load_document",
          [](docling::docling_threaded_parser& self,
@@ -996,6 +1227,8 @@ PYBIND11_MODULE(pdf_parsers, m) {
          R"(
     Load a document by key and filename.
 
+    Once the workers are running, the pages of the document are queued right away.
+
     Parameters:
         key (str): The unique key to identify the document.
         filename (str): The path to the document file to load.
@@ -1020,6 +1253,8 @@ PYBIND11_MODULE(pdf_parsers, m) {
          R"(
     Load a document from a BytesIO-like object.
 
+    Once the workers are running, the pages of the document are queued right away.
+
     Parameters:
         key (str): The unique key to identify the document.
         bytes_io (Any): A BytesIO-like object containing the document data.
@@ -1029,6 +1264,29 @@ PYBIND11_MODULE(pdf_parsers, m) {
     Returns:
         bool: True if the document was successfully loaded.)")
 
+    .def("load_documents",
+         &load_threaded_documents<docling::docling_threaded_parser>,
+         pybind11::arg("keys"),
+         pybind11::arg("sources"),
+         pybind11::arg("password") = pybind11::none(),
+         pybind11::arg("page_numbers") = pybind11::none(),
+         R"(
+    Load several documents in parallel, without holding the GIL.
+
+    Starts the workers first, so the pages of a document are decoded as soon as it is
+    loaded, while the next documents are still loading. The documents are loaded on up
+    to num_threads loader threads next to the workers, so up to twice num_threads
+    threads may be busy until the last document is loaded.
+
+    Parameters:
+        keys (List[str]): The unique keys of the documents.
+        sources (List[Union[str, bytes]]): Per key, a filename or the document data.
+        password (str, optional): Optional password, used for all documents.
+        page_numbers (Sequence[int], optional): Selected 1-indexed physical pages, used for all documents.
+
+    Returns:
+        List[str]: Per key, the error message, or an empty string if the document was loaded.)")
+
     .def("number_of_pages",
          [](docling::docling_threaded_parser& self, const std::string& key) -> int {
            return self.number_of_pages(key);
@@ -1061,7 +1319,7 @@ PYBIND11_MODULE(pdf_parsers, m) {
          },
          pybind11::arg("key"),
          R"(
-    Unload one document after threaded processing is complete.
+    Unload one document once all of its scheduled pages have been consumed.
 
     Returns:
         bool: True when document state existed and was removed.)")
@@ -1080,6 +1338,7 @@ PYBIND11_MODULE(pdf_parsers, m) {
     Check if there are remaining tasks to consume.
 
     On first call, builds the task queue from all loaded documents and starts worker threads.
+    Documents loaded afterwards are queued as they are loaded.
 
     Returns:
         bool: True if there are remaining results to consume.)")
@@ -1115,6 +1374,8 @@ PYBIND11_MODULE(pdf_parsers, m) {
         scale (float): Target render scale in multiples of the PDF page size; -1 disables scale-based sizing [default=-1].
         canvas_width (int): Target canvas width in pixels; -1 means use PDF page size [default=-1].
         canvas_height (int): Target canvas height in pixels; -1 means use PDF page size [default=-1].
+        render_threads (int): Blend2D threads rasterizing one page; 0 renders synchronously, -1 picks automatically [default=0].
+        region (list[float]): Page-space region [x0, y0, x1, y1] (bottom-left origin) to rasterize at the page resolution; all zeros renders the full page [default=[0, 0, 0, 0]].
     )")
     .def(pybind11::init<>())
     .def_readwrite("render_text",             &pdflib::render_config::render_text)
@@ -1126,7 +1387,9 @@ PYBIND11_MODULE(pdf_parsers, m) {
     .def_readwrite("font_similarity_cutoff",  &pdflib::render_config::font_similarity_cutoff)
     .def_readwrite("scale",                   &pdflib::render_config::scale)
     .def_readwrite("canvas_width",            &pdflib::render_config::canvas_width)
-    .def_readwrite("canvas_height",           &pdflib::render_config::canvas_height);
+    .def_readwrite("canvas_height",           &pdflib::render_config::canvas_height)
+    .def_readwrite("render_threads",          &pdflib::render_config::render_threads)
+    .def_readwrite("region",                  &pdflib::render_config::region);
 
   // _PageRenderResult - internal result of a threaded page render task
   pybind11::class_<docling::page_render_result, docling::page_task_result>(m, "_PageRenderResult",
@@ -1140,8 +1403,10 @@ PYBIND11_MODULE(pdf_parsers, m) {
         timings: Top-level timing breakdown for decode and render stages.
         image_data: Raw RGBA bytes of the rendered page (height x width x 4, row-major).
         image_shape: Shape of the image as [height, width, channels].
+        render_threads (int): Blend2D worker threads the page was rasterized on (0: synchronously).
     )")
     .def_readonly("timings", &docling::page_render_result::timings)
+    .def_readonly("render_threads", &docling::page_render_result::render_threads)
     .def("get", [](docling::page_render_result& self)
          -> std::pair<std::shared_ptr<pdflib::pdf_decoder<pdflib::PAGE>>,
                       std::unordered_map<std::string, double>> {
@@ -1200,12 +1465,15 @@ PYBIND11_MODULE(pdf_parsers, m) {
     Results are available via a bounded queue to control memory usage.
     )")
     .def(pybind11::init<const std::string&, int, int,
-                        pdflib::decode_config, pdflib::render_config>(),
-         pybind11::arg("loglevel")               = "fatal",
-         pybind11::arg("num_threads")            = 4,
-         pybind11::arg("max_concurrent_results") = 32,
-         pybind11::arg("decode_config")          = pdflib::decode_config(),
-         pybind11::arg("render_config")          = pdflib::render_config(),
+                        pdflib::decode_config, pdflib::render_config, bool, const std::string&, int64_t>(),
+         pybind11::arg("loglevel")                   = "fatal",
+         pybind11::arg("num_threads")                = 4,
+         pybind11::arg("max_concurrent_results")     = 32,
+         pybind11::arg("decode_config")              = pdflib::decode_config(),
+         pybind11::arg("render_config")              = pdflib::render_config(),
+         pybind11::arg("unload_completed_documents") = false,
+         pybind11::arg("scheduling")                 = "fifo",
+         pybind11::arg("max_result_bytes")           = 0,
          R"(
     Construct a threaded PDF renderer.
 
@@ -1214,7 +1482,11 @@ PYBIND11_MODULE(pdf_parsers, m) {
         num_threads (int): Number of worker threads.
         max_concurrent_results (int): Maximum results buffered before workers pause.
         decode_config (DecodePageConfig): Configuration for page decoding.
-        render_config (RenderConfig): Configuration for page rendering.)")
+        render_config (RenderConfig): Configuration for page rendering.
+        unload_completed_documents (bool): Unload a document once the result of its last page is consumed.
+        scheduling (str): Page order, 'fifo' or 'longest_first' (by estimated decode cost).
+        max_result_bytes (int): Budget on the estimated bytes of the buffered results (0: no budget);
+            workers pause while the buffered results hold at least this much.)")
 
     .def("load_document",
          [](docling::docling_threaded_renderer& self,
@@ -1242,6 +1514,13 @@ PYBIND11_MODULE(pdf_parsers, m) {
          pybind11::arg("password") = pybind11::none(),
          pybind11::arg("page_numbers") = pybind11::none())
 
+    .def("load_documents",
+         &load_threaded_documents<docling::docling_threaded_renderer>,
+         pybind11::arg("keys"),
+         pybind11::arg("sources"),
+         pybind11::arg("password") = pybind11::none(),
+         pybind11::arg("page_numbers") = pybind11::none())
+
     .def("number_of_pages",
          [](docling::docling_threaded_renderer& self, const std::string& key) -> int {
            return self.number_of_pages(key);
@@ -7,6 +7,7 @@
 #include <atomic>
 #include <cctype>
 #include <chrono>
+#include <cmath>
 #include <condition_variable>
 #include <cstdlib>
 #include <filesystem>
@@ -38,6 +39,12 @@ namespace
     both,
   };
 
+  enum class task_order
+  {
+    fifo,
+    longest_first,
+  };
+
   struct scheduled_doc
   {
     std::filesystem::path path;
@@ -54,6 +61,7 @@ namespace
   struct page_timings
   {
     double total_s = 0.0;
+    double open_document_s = 0.0;
     double make_page_decoder_s = 0.0;
     double decode_page_s = 0.0;
     double create_word_cells_s = 0.0;
@@ -79,6 +87,16 @@ namespace
     int errors = 0;
   };
 
+  // the batches of one thread-count and task-order, run one after the other
+  struct batch_results
+  {
+    int threads = 0;
+    task_order order = task_order::fifo;
+    std::vector<double> makespans_s;
+    double wall_time_s = 0.0;
+    int errors = 0;
+  };
+
   struct cli_options
   {
     std::filesystem::path input;
@@ -87,6 +105,8 @@ namespace
     std::optional<int> max_pages = std::nullopt;
     int max_concurrent_results = 64;
     std::vector<int> threads{1, 2, 4, 8, 12, 16};
+    std::vector<task_order> orders{task_order::fifo};
+    int batch_pages = 0;
     float scale = 1.0f;
     bool enable_timing = false;
     std::filesystem::path timing_csv = "timing-cpp.csv";
@@ -131,6 +151,69 @@ namespace
     return "render";
   }
 
+  std::string order_to_string(task_order order)
+  {
+    switch(order)
+      {
+      case task_order::fifo: return "fifo";
+      case task_order::longest_first: return "longest_first";
+      }
+    return "fifo";
+  }
+
+  std::vector<task_order> parse_task_orders(const std::string& raw)
+  {
+    std::vector<task_order> values;
+    std::stringstream ss(raw);
+    std::string token;
+
+    while(std::getline(ss, token, ','))
+      {
+        std::transform(token.begin(), token.end(), token.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+
+        if(token.empty())
+          {
+            continue;
+          }
+        else if(token == "fifo")
+          {
+            values.push_back(task_order::fifo);
+          }
+        else if(token == "longest_first")
+          {
+            values.push_back(task_order::longest_first);
+          }
+        else
+          {
+            throw std::runtime_error("--scheduling must contain fifo and/or longest_first");
+          }
+      }
+
+    if(values.empty())
+      {
+        throw std::runtime_error("--scheduling must contain at least one value");
+      }
+
+    return values;
+  }
+
+  // nearest-rank percentile, `fraction` in [0, 1]
+  double percentile(std::vector<double> values, double fraction)
+  {
+    if(values.empty())
+      {
+        return 0.0;
+      }
+
+    std::sort(values.begin(), values.end());
+
+    std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * values.size()));
+    rank = std::min(std::max<std::size_t>(rank, 1), values.size());
+
+    return values[rank - 1];
+  }
+
   std::vector<int> parse_thread_counts(const std::string& raw)
   {
     std::vector<int> values;
@@ -450,16 +533,72 @@ namespace
     return docs;
   }
 
-  std::vector<page_task> build_tasks(const std::vector<scheduled_doc>& schedule)
+  // Splits the schedule into consecutive batches of whole documents with at
+  // least `batch_pages` pages each (the last one may be smaller); a single
+  // batch when batch_pages <= 0.
+  std::vector<std::vector<std::size_t>> make_batches(const std::vector<scheduled_doc>& schedule,
+                                                     int batch_pages)
   {
-    std::vector<page_task> tasks;
+    std::vector<std::vector<std::size_t>> batches(1);
+
+    int pages = 0;
     for(std::size_t doc_index = 0; doc_index < schedule.size(); ++doc_index)
+      {
+        if(batch_pages > 0 and pages >= batch_pages)
+          {
+            batches.emplace_back();
+            pages = 0;
+          }
+
+        batches.back().push_back(doc_index);
+        pages += static_cast<int>(schedule[doc_index].pages.size());
+      }
+
+    return batches;
+  }
+
+  // Same orders as the threaded parser (see docling::page_scheduling): FIFO
+  // keeps document and page order, longest-first sorts on page_cost.
+  std::vector<page_task> build_tasks(const std::vector<scheduled_doc>& schedule,
+                                     const std::vector<doc_decoder_ptr>& docs,
+                                     const std::vector<std::size_t>& batch,
+                                     task_order order)
+  {
+    std::vector<page_task> tasks;
+    std::vector<double> costs;
+    for(std::size_t doc_index : batch)
       {
         for(int page : schedule[doc_index].pages)
           {
             tasks.push_back(page_task{doc_index, page});
+
+            if(order == task_order::longest_first)
+              {
+                costs.push_back(docs[doc_index]->estimate_page_cost(page));
+              }
+          }
+      }
+
+    if(order == task_order::longest_first)
+      {
+        std::vector<std::size_t> indices(tasks.size());
+        for(std::size_t i = 0; i < indices.size(); ++i)
+          {
+            indices[i] = i;
+          }
+
+        std::stable_sort(indices.begin(), indices.end(),
+                         [&costs](std::size_t lhs, std::size_t rhs) { return costs[lhs] > costs[rhs]; });
+
+        std::vector<page_task> sorted_tasks;
+        sorted_tasks.reserve(tasks.size());
+        for(std::size_t i : indices)
+          {
+            sorted_tasks.push_back(tasks[i]);
           }
+        tasks = std::move(sorted_tasks);
       }
+
     return tasks;
   }
 
@@ -507,7 +646,8 @@ namespace
       if(write_header)
         {
           out_ << "mode,threads,render,doc_key,page_number,success,"
-               << "timing_total_s,timing_make_page_decoder_s,timing_decode_page_s,"
+               << "timing_total_s,timing_open_document_s,timing_make_page_decoder_s,"
+               << "timing_decode_page_s,"
                << "timing_create_word_cells_s,timing_create_line_cells_s,"
                << "timing_render_page_s,error_message\n";
         }
@@ -530,6 +670,7 @@ namespace
            << (result.page_number + 1) << ','
            << (result.success ? "true" : "false") << ','
            << result.timings.total_s << ','
+           << result.timings.open_document_s << ','
            << result.timings.make_page_decoder_s << ','
            << result.timings.decode_page_s << ','
            << result.timings.create_word_cells_s << ','
@@ -549,12 +690,16 @@ namespace
   public:
     threaded_benchmark(const std::vector<scheduled_doc>& schedule,
                        const std::vector<doc_decoder_ptr>& docs,
+                       const std::vector<std::size_t>& batch,
+                       task_order order,
                        int num_threads,
                        int max_concurrent_results,
                        pdflib::decode_config decode_config,
                        std::optional<pdflib::render_config> render_config):
       schedule_(schedule),
       docs_(docs),
+      batch_(batch),
+      order_(order),
       num_threads_(num_threads),
       max_concurrent_results_(max_concurrent_results),
       decode_config_(decode_config),
@@ -571,15 +716,16 @@ namespace
                          bool enable_timing,
                          const std::filesystem::path& timing_csv)
     {
-      tasks_ = build_tasks(schedule_);
-      next_task_.store(0);
-      tasks_remaining_.store(static_cast<int>(tasks_.size()));
-      active_workers_.store(std::min(num_threads_, static_cast<int>(tasks_.size())));
-
       timing_csv_writer csv_writer(enable_timing, timing_csv);
 
+      // the makespan includes the cost estimates of longest-first ordering
       auto start = clock_type::now();
 
+      tasks_ = build_tasks(schedule_, docs_, batch_, order_);
+      next_task_.store(0);
+      tasks_remaining_.store(static_cast<int>(tasks_.size()));
+      active_workers_.store(std::min(num_threads_, static_cast<int>(tasks_.size())));
+
       for(int i = 0; i < active_workers_.load(); ++i)
         {
           workers_.emplace_back(&threaded_benchmark::worker_loop, this);
@@ -618,6 +764,9 @@ namespace
   private:
     void worker_loop()
     {
+      // one QPDF document per loaded pdf, opened lazily by this worker
+      std::unordered_map<std::size_t, std::shared_ptr<QPDF>> worker_documents;
+
       while(true)
         {
           const std::size_t task_index = next_task_.fetch_add(1);
@@ -636,9 +785,19 @@ namespace
               auto total_start = clock_type::now();
 
               auto stage_start = clock_type::now();
+              auto& worker_document = worker_documents[task.doc_index];
+              if(worker_document == nullptr)
+                {
+                  worker_document = docs_[task.doc_index]->open_thread_safe_document(
+                    decode_config_.keep_qpdf_warnings);
+                }
+              result.timings.open_document_s =
+                std::chrono::duration<double>(clock_type::now() - stage_start).count();
+
+              stage_start = clock_type::now();
               auto page_decoder = docs_[task.doc_index]->make_thread_safe_page_decoder(
                 task.page_number,
-                decode_config_.keep_qpdf_warnings);
+                worker_document);
               result.timings.make_page_decoder_s =
                 std::chrono::duration<double>(clock_type::now() - stage_start).count();
 
@@ -729,6 +888,8 @@ namespace
   private:
     const std::vector<scheduled_doc>& schedule_;
     const std::vector<doc_decoder_ptr>& docs_;
+    const std::vector<std::size_t>& batch_;
+    task_order order_;
     int num_threads_;
     int max_concurrent_results_;
     pdflib::decode_config decode_config_;
@@ -771,26 +932,38 @@ namespace
   }
 
   void print_table(const std::string& title,
-                   const std::vector<benchmark_result>& results,
+                   const std::vector<batch_results>& results,
                    int total_pages)
   {
-    const double t1 = results.empty() ? 0.0 : results.front().wall_time_s;
-
     std::cout << "\n=== " << title << " ===\n";
     std::cout << std::left
               << std::setw(18) << "backend"
+              << std::setw(16) << "scheduling"
               << std::right
               << std::setw(10) << "threads"
               << std::setw(18) << "wall_time (s)"
               << std::setw(18) << "vs threaded(1)"
               << std::setw(14) << "pages/sec"
               << std::setw(12) << "ms/page"
+              << std::setw(18) << "makespan p50 (s)"
+              << std::setw(18) << "makespan p99 (s)"
               << std::setw(10) << "errors"
               << "\n";
-    std::cout << std::string(100, '-') << "\n";
+    std::cout << std::string(152, '-') << "\n";
 
     for(const auto& result : results)
       {
+        // compare with the first thread count of the same order
+        double t1 = 0.0;
+        for(const auto& other : results)
+          {
+            if(other.order == result.order)
+              {
+                t1 = other.wall_time_s;
+                break;
+              }
+          }
+
         const double speedup = result.wall_time_s > 0.0 ? t1 / result.wall_time_s : 0.0;
         const double pages_per_sec = result.wall_time_s > 0.0
           ? static_cast<double>(total_pages) / result.wall_time_s : 0.0;
@@ -802,12 +975,15 @@ namespace
 
         std::cout << std::left
                   << std::setw(18) << "docling threaded"
+                  << std::setw(16) << order_to_string(result.order)
                   << std::right
                   << std::setw(10) << result.threads
                   << std::setw(18) << std::fixed << std::setprecision(3) << result.wall_time_s
                   << std::setw(18) << speedup_ss.str()
                   << std::setw(14) << std::fixed << std::setprecision(1) << pages_per_sec
                   << std::setw(12) << std::fixed << std::setprecision(2) << ms_per_page
+                  << std::setw(18) << std::fixed << std::setprecision(3) << percentile(result.makespans_s, 0.50)
+                  << std::setw(18) << std::fixed << std::setprecision(3) << percentile(result.makespans_s, 0.99)
                   << std::setw(10) << result.errors
                   << "\n";
       }
@@ -832,6 +1008,8 @@ namespace
       ("max-pages,l", "Maximum number of pages to process across all input PDFs", cxxopts::value<int>())
       ("max-concurrent-results", "Max buffered results for threaded processing", cxxopts::value<int>()->default_value("64"))
       ("threads", "Comma-separated thread counts", cxxopts::value<std::string>()->default_value("1,2,4,8,12,16"))
+      ("scheduling", "Comma-separated page orders [fifo, longest_first]", cxxopts::value<std::string>()->default_value("fifo"))
+      ("batch-pages", "Split the input into batches of whole documents with at least this many pages (0: one batch)", cxxopts::value<int>()->default_value("0"))
       ("scale", "Render scale for render mode", cxxopts::value<float>()->default_value("1.0"))
       ("enable-timing", "Write one CSV timing row per page result", cxxopts::value<bool>()->default_value("false")->implicit_value("true"))
       ("timing-csv", "CSV path used when --enable-timing is set", cxxopts::value<std::string>()->default_value("timing-cpp.csv"))
@@ -873,6 +1051,8 @@ namespace
         throw std::runtime_error("--max-concurrent-results must be positive");
       }
     cli.threads = parse_thread_counts(result["threads"].as<std::string>());
+    cli.orders = parse_task_orders(result["scheduling"].as<std::string>());
+    cli.batch_pages = result["batch-pages"].as<int>();
     cli.scale = result["scale"].as<float>();
     cli.enable_timing = result["enable-timing"].as<bool>();
     cli.timing_csv = result["timing-csv"].as<std::string>();
@@ -961,6 +1141,13 @@ int main(int argc, char* argv[])
           std::cout << cli.threads[i];
         }
       std::cout << "\n";
+      std::cout << "Scheduling: ";
+      for(std::size_t i = 0; i < cli.orders.size(); ++i)
+        {
+          if(i > 0) { std::cout << ","; }
+          std::cout << order_to_string(cli.orders[i]);
+        }
+      std::cout << "\n";
       std::cout << "Max concurrent results: " << cli.max_concurrent_results << "\n";
       if(cli.mode == run_mode::render or cli.mode == run_mode::both)
         {
@@ -978,6 +1165,9 @@ int main(int argc, char* argv[])
       std::cout << "\nLoading documents ...\n";
       auto docs = load_documents(schedule);
 
+      auto batches = make_batches(schedule, cli.batch_pages);
+      std::cout << "Batches: " << batches.size() << "\n";
+
       std::vector<run_mode> modes;
       if(cli.mode == run_mode::both)
         {
@@ -994,32 +1184,52 @@ int main(int argc, char* argv[])
           const std::string title = render ? "RENDER (decode + rasterise)" : "PARSE (decode only)";
           std::cout << "\n##### " << title << " #####\n";
 
-          std::vector<benchmark_result> results;
-          for(int threads : cli.threads)
+          std::vector<batch_results> results;
+          for(task_order order : cli.orders)
             {
-              std::cout << "Running threaded "
-                        << (render ? "renderer" : "parser")
-                        << " with " << threads << " threads ...\n";
-
-              threaded_benchmark benchmark(schedule,
-                                           docs,
-                                           threads,
-                                           cli.max_concurrent_results,
-                                           decode_config,
-                                           render ? std::optional<pdflib::render_config>(render_config)
-                                                  : std::nullopt);
-              benchmark_result result = benchmark.run(render ? "render" : "parse",
-                                                      cli.enable_timing,
-                                                      cli.timing_csv);
-              results.push_back(result);
-              std::cout << "  threads=" << threads
-                        << ": " << std::fixed << std::setprecision(3)
-                        << result.wall_time_s << "s";
-              if(result.errors > 0)
+              for(int threads : cli.threads)
                 {
-                  std::cout << " (" << result.errors << " errors)";
+                  std::cout << "Running threaded "
+                            << (render ? "renderer" : "parser")
+                            << " with " << threads << " threads ("
+                            << order_to_string(order) << ") ...\n";
+
+                  batch_results batch_result;
+                  batch_result.threads = threads;
+                  batch_result.order = order;
+
+                  for(const auto& batch : batches)
+                    {
+                      threaded_benchmark benchmark(schedule,
+                                                   docs,
+                                                   batch,
+                                                   order,
+                                                   threads,
+                                                   cli.max_concurrent_results,
+                                                   decode_config,
+                                                   render ? std::optional<pdflib::render_config>(render_config)
+                                                          : std::nullopt);
+                      benchmark_result result = benchmark.run(render ? "render" : "parse",
+                                                              cli.enable_timing,
+                                                              cli.timing_csv);
+
+                      batch_result.makespans_s.push_back(result.wall_time_s);
+                      batch_result.wall_time_s += result.wall_time_s;
+                      batch_result.errors += result.errors;
+                    }
+
+                  results.push_back(batch_result);
+                  std::cout << "  threads=" << threads
+                            << ": " << std::fixed << std::setprecision(3)
+                            << batch_result.wall_time_s << "s"
+                            << " (makespan p50=" << percentile(batch_result.makespans_s, 0.50)
+                            << "s, p99=" << percentile(batch_result.makespans_s, 0.99) << "s)";
+                  if(batch_result.errors > 0)
+                    {
+                      std::cout << " (" << batch_result.errors << " errors)";
+                    }
+                  std::cout << "\n";
                 }
-              std::cout << "\n";
             }
 
           print_table(title, results, total_pages);
@@ -0,0 +1,17 @@
+# Runs compile_resources.exe for the `compiled_resources` target, as
+#
+#   cmake -DCOMPILE_RESOURCES_EXE=... -DPDF_DATA_DIR=... -DOUTPUT_DIR=... -P compile_resources.cmake
+#
+# A failure only warns: without the compiled tables, the parser reads the
+# text resources.
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+execute_process(
+    COMMAND "${COMPILE_RESOURCES_EXE}" "${PDF_DATA_DIR}" "${OUTPUT_DIR}"
+    RESULT_VARIABLE COMPILE_RESOURCES_RESULT)
+
+if(NOT COMPILE_RESOURCES_RESULT EQUAL 0)
+    message(WARNING "compiling pdf_resources failed (${COMPILE_RESOURCES_RESULT}), the text resources will be used")
+    file(REMOVE "${OUTPUT_DIR}/cmap-resources.bin" "${OUTPUT_DIR}/font-resources.bin")
+endif()
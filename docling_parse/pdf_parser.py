@@ -3,7 +3,7 @@
 import hashlib
 import logging
 import math
-from enum import IntEnum
+from enum import Enum, IntEnum
 from io import BytesIO
 from pathlib import Path
 from typing import Any, Dict, Iterator, List, Optional, Sequence, Tuple, Union
@@ -25,6 +25,7 @@ from docling_core.types.doc.page import (
     PdfWidget,
     SegmentedPdfPage,
     TextCell,
+    TextCellUnit,
     TextDirection,
 )
 from PIL import Image as PILImage
@@ -190,6 +191,7 @@ class PageDecodeTimings(BaseModel):
 
     model_config = ConfigDict(validate_assignment=True)
 
+    open_document_s: float = 0.0
     make_page_decoder_s: float = 0.0
     decode_page_s: float = 0.0
     create_word_cells_s: float = 0.0
@@ -261,10 +263,13 @@ class DecodeConfig(BaseModel):
     max_num_lines: int = -1
     max_num_bitmaps: int = -1
     min_visible_clip_extent: float = 1e-3
+    # Render scale to decode JPEG/JPEG2000 bitmaps for (-1 = native resolution).
+    bitmap_decode_scale: float = -1.0
     do_thread_safe: bool = True
     release_native_memory_every_n_pages: int = 0
     keep_glyphs: bool = False
     keep_qpdf_warnings: bool = False
+    native_content_lexer: bool = True
 
 
 def _compile_decode_config(
@@ -291,12 +296,14 @@ def _compile_decode_config(
     cpp.max_num_lines = decode_config.max_num_lines
     cpp.max_num_bitmaps = decode_config.max_num_bitmaps
     cpp.min_visible_clip_extent = decode_config.min_visible_clip_extent
+    cpp.bitmap_decode_scale = decode_config.bitmap_decode_scale
     cpp.do_thread_safe = decode_config.do_thread_safe
     cpp.release_native_memory_every_n_pages = (
         decode_config.release_native_memory_every_n_pages
     )
     cpp.keep_glyphs = decode_config.keep_glyphs
     cpp.keep_qpdf_warnings = decode_config.keep_qpdf_warnings
+    cpp.native_content_lexer = decode_config.native_content_lexer
     cpp.keep_char_cells = (
         content_config.char_cells_content_level >= ContentLevel.COMPUTE
     )
@@ -316,6 +323,7 @@ def _page_timings_from_raw(
 ) -> PageDecodeTimings | PageRenderTimings:
     """Copy native threaded timing objects into the public Pydantic timing models."""
     data = {
+        "open_document_s": raw_timings.open_document_s,
         "make_page_decoder_s": raw_timings.make_page_decoder_s,
         "decode_page_s": raw_timings.decode_page_s,
         "create_word_cells_s": raw_timings.create_word_cells_s,
@@ -389,7 +397,12 @@ def _to_page_geometry_from_decoder(
     )
 
 
-def _to_cells_from_decoder(cells_container) -> List[Union[PdfTextCell, TextCell]]:
+def _to_cells_from_decoder(
+    cells_container, columnar: bool = False
+) -> List[Union[PdfTextCell, TextCell]]:
+    if columnar:
+        return _to_cells_from_columns(cells_container.to_columns())
+
     result: List[Union[PdfTextCell, TextCell]] = []
 
     for ind, cell in enumerate(cells_container):
@@ -423,7 +436,62 @@ def _to_cells_from_decoder(cells_container) -> List[Union[PdfTextCell, TextCell]
     return result
 
 
-def _to_shapes_from_decoder(shapes_container) -> List[PdfShape]:
+def _to_cells_from_columns(columns) -> List[Union[PdfTextCell, TextCell]]:
+    """Same as _to_cells_from_decoder, from the columns of PdfCells.to_columns()."""
+    result: List[Union[PdfTextCell, TextCell]] = []
+
+    rects = memoryview(columns.rect).tolist()
+    font_ids = memoryview(columns.font_ids).tolist()
+    rendering_modes = memoryview(columns.rendering_mode).tolist()
+    flags = memoryview(columns.flags).tolist()
+
+    text = bytes(memoryview(columns.text))
+    text_offsets = memoryview(columns.text_offsets).tolist()
+
+    font_keys = columns.font_keys
+    font_names = columns.font_names
+
+    left_to_right_flag = columns.FLAG_LEFT_TO_RIGHT
+    widget_flag = columns.FLAG_WIDGET
+
+    for ind, rect in enumerate(rects):
+        cell_text = text[text_offsets[ind] : text_offsets[ind + 1]].decode("utf-8")
+        font_id = font_ids[ind]
+
+        result.append(
+            PdfTextCell(
+                rect=BoundingRectangle(
+                    r_x0=rect[0],
+                    r_y0=rect[1],
+                    r_x1=rect[2],
+                    r_y1=rect[3],
+                    r_x2=rect[4],
+                    r_y2=rect[5],
+                    r_x3=rect[6],
+                    r_y3=rect[7],
+                ),
+                text=cell_text,
+                orig=cell_text,
+                font_key=font_keys[font_id],
+                font_name=font_names[font_id],
+                widget=bool(flags[ind] & widget_flag),
+                text_direction=(
+                    TextDirection.LEFT_TO_RIGHT
+                    if flags[ind] & left_to_right_flag
+                    else TextDirection.RIGHT_TO_LEFT
+                ),
+                index=ind,
+                rendering_mode=rendering_modes[ind],
+            )
+        )
+
+    return result
+
+
+def _to_shapes_from_decoder(shapes_container, columnar: bool = False) -> List[PdfShape]:
+    if columnar:
+        return _to_shapes_from_columns(shapes_container.to_columns())
+
     result: List[PdfShape] = []
 
     for ind, shape in enumerate(shapes_container):
@@ -463,6 +531,68 @@ def _to_shapes_from_decoder(shapes_container) -> List[PdfShape]:
     return result
 
 
+def _to_shapes_from_columns(columns) -> List[PdfShape]:
+    """Same as _to_shapes_from_decoder, from the columns of PdfShapes.to_columns()."""
+    result: List[PdfShape] = []
+
+    x_coords = memoryview(columns.x).tolist()
+    y_coords = memoryview(columns.y).tolist()
+    point_offsets = memoryview(columns.point_offsets).tolist()
+
+    indices = memoryview(columns.i).tolist()
+    index_offsets = memoryview(columns.index_offsets).tolist()
+
+    has_graphics_state = memoryview(columns.has_graphics_state).tolist()
+    line_width = memoryview(columns.line_width).tolist()
+    miter_limit = memoryview(columns.miter_limit).tolist()
+    line_cap = memoryview(columns.line_cap).tolist()
+    line_join = memoryview(columns.line_join).tolist()
+    dash_phase = memoryview(columns.dash_phase).tolist()
+    flatness = memoryview(columns.flatness).tolist()
+
+    dash_array = memoryview(columns.dash_array).tolist()
+    dash_offsets = memoryview(columns.dash_offsets).tolist()
+
+    rgb_stroking = memoryview(columns.rgb_stroking).tolist()
+    rgb_filling = memoryview(columns.rgb_filling).tolist()
+
+    for ind in range(len(line_width)):
+        offset = point_offsets[ind]
+        i_beg = index_offsets[ind]
+        i_end = index_offsets[ind + 1]
+
+        rgb_s = rgb_stroking[ind]
+        rgb_f = rgb_filling[ind]
+
+        for pair_idx in range(0, i_end - i_beg, 2):
+            i0: int = indices[i_beg + pair_idx + 0]
+            i1: int = indices[i_beg + pair_idx + 1]
+
+            points: List[Coord2D] = []
+            for k in range(offset + i0, offset + i1):
+                points.append(Coord2D(x_coords[k], y_coords[k]))
+
+            result.append(
+                PdfShape(
+                    index=ind,
+                    parent_id=pair_idx,
+                    points=points,
+                    has_graphics_state=bool(has_graphics_state[ind]),
+                    line_width=line_width[ind],
+                    miter_limit=miter_limit[ind],
+                    line_cap=line_cap[ind],
+                    line_join=line_join[ind],
+                    dash_phase=dash_phase[ind],
+                    dash_array=dash_array[dash_offsets[ind] : dash_offsets[ind + 1]],
+                    flatness=flatness[ind],
+                    rgb_stroking=ColorRGBA(r=rgb_s[0], g=rgb_s[1], b=rgb_s[2]),
+                    rgb_filling=ColorRGBA(r=rgb_f[0], g=rgb_f[1], b=rgb_f[2]),
+                )
+            )
+
+    return result
+
+
 def _to_widgets_from_decoder(widgets_container) -> List[PdfWidget]:
     result: List[PdfWidget] = []
 
@@ -600,14 +730,20 @@ def segmented_page_from_decoder(
     page_decoder: PdfPageDecoder,
     boundary_type: PdfPageBoundaryType = PdfPageBoundaryType.CROP_BOX,
     content_config: ContentConfig | None = None,
+    columnar: bool = False,
 ) -> SegmentedPdfPage:
-    """Convert a C++ PdfPageDecoder to a SegmentedPdfPage."""
+    """Convert a C++ PdfPageDecoder to a SegmentedPdfPage.
+
+    With columnar, the cells and shapes are copied out of the decoder in
+    contiguous columns (see PdfCells.to_columns) instead of attribute by
+    attribute, which is much faster for dense pages.
+    """
     if content_config is None:
         content_config = ContentConfig()
     MAT = ContentLevel.COMPUTE_AND_MATERIALIZE
 
     char_cells = (
-        _to_cells_from_decoder(page_decoder.get_char_cells())
+        _to_cells_from_decoder(page_decoder.get_char_cells(), columnar)
         if content_config.char_cells_content_level == MAT
         else []
     )
@@ -629,7 +765,7 @@ def segmented_page_from_decoder(
             else []
         ),
         shapes=(
-            _to_shapes_from_decoder(page_decoder.get_page_shapes())
+            _to_shapes_from_decoder(page_decoder.get_page_shapes(), columnar)
             if content_config.shapes_content_level == MAT
             else []
         ),
@@ -639,13 +775,13 @@ def segmented_page_from_decoder(
 
     if content_config.word_cells_content_level == MAT and page_decoder.has_word_cells():
         segmented_page.word_cells = _to_cells_from_decoder(
-            page_decoder.get_word_cells()
+            page_decoder.get_word_cells(), columnar
         )
         segmented_page.has_words = len(segmented_page.word_cells) > 0
 
     if content_config.line_cells_content_level == MAT and page_decoder.has_line_cells():
         segmented_page.textline_cells = _to_cells_from_decoder(
-            page_decoder.get_line_cells()
+            page_decoder.get_line_cells(), columnar
         )
         segmented_page.has_lines = len(segmented_page.textline_cells) > 0
 
@@ -760,6 +896,44 @@ class PdfDocument:
         self._decoded_content_configs[page_no] = decode_content_config.model_copy()
         return decoder
 
+    def prefetch_pages(
+        self,
+        page_nos: Sequence[int],
+        *,
+        content_config: ContentConfig | None = None,
+    ) -> None:
+        """Decode pages in the background, so a later get_page finds them ready.
+
+        This returns immediately. The pages are decoded on native worker
+        threads (without the GIL) into the page-decoder cache, so decoding
+        overlaps with whatever the caller does meanwhile. Pages that are
+        already decoded are skipped.
+        """
+        cc = (content_config or self._content_config).model_copy()
+
+        pages: List[int] = []
+        for page_no in page_nos:
+            if not (1 <= page_no <= self.number_of_pages()):
+                raise ValueError(
+                    f"incorrect page_no: {page_no} for key={self._key} "
+                    f"(min:1, max:{self.number_of_pages()})"
+                )
+            if page_no in self._decoded_content_configs:
+                continue
+
+            pages.append(page_no - 1)
+            self._decoded_content_configs[page_no] = cc.model_copy()
+
+        if len(pages) == 0:
+            return
+
+        cpp = _compile_decode_config(
+            decode_config=self._decode_config,
+            page_boundary=self._boundary_type.value,
+            content_config=cc,
+        )
+        self._parser.prefetch_pages(key=self._key, pages=pages, config=cpp)
+
     def is_loaded(self) -> bool:
         return self._parser.is_loaded(key=self._key)
 
@@ -813,6 +987,16 @@ class PdfDocument:
         else:
             raise RuntimeError("This document is not loaded.")
 
+    def get_document_timings(self) -> Dict[str, List[float]]:
+        """Return the recorded durations (seconds) of the document-level work.
+
+        This covers loading the document and the extraction of the annotations,
+        metadata and table of contents, each recorded on its first use.
+        """
+        if not self.is_loaded():
+            raise RuntimeError("This document is not loaded.")
+        return dict(self._parser.get_document_timings(key=self._key))
+
     def get_table_of_contents(self) -> PdfTableOfContents | None:
         if self.is_loaded():
             toc = self._parser.get_table_of_contents(key=self._key)
@@ -1083,6 +1267,13 @@ class DoclingPdfParser:
         )
 
 
+class PageScheduling(str, Enum):
+    """Order in which the threaded parser hands pages to its workers."""
+
+    FIFO = "fifo"  # document by document, in page order
+    LONGEST_FIRST = "longest_first"  # by decreasing estimated decode cost
+
+
 class ThreadedPdfParserConfig(BaseModel):
     """Configuration for the threaded PDF parser.
 
@@ -1092,6 +1283,17 @@ class ThreadedPdfParserConfig(BaseModel):
         max_concurrent_results: Maximum results buffered before workers pause.
         boundary_type: Page boundary used for geometry conversion and page sizing.
         render_config: Optional render configuration for parse-and-render mode.
+        unload_completed_documents: Unload a document as soon as the result of its
+            last scheduled page is consumed, so the parser can run as a long-lived
+            pipeline that documents are loaded into while results are consumed.
+        scheduling: Page order. LONGEST_FIRST estimates the cost of each page from
+            its content-stream, image and font sizes (without decoding it) and starts
+            the most expensive pages first, which shortens the tail of a batch.
+        max_result_bytes: Budget on the estimated memory (cells, shapes, image
+            streams, decoded bitmaps and rendered images) of the buffered results;
+            workers pause while the buffered results hold at least this many
+            bytes. 0 disables the budget, max_concurrent_results remains a cap on
+            their number.
     """
 
     model_config = ConfigDict(arbitrary_types_allowed=True)
@@ -1102,6 +1304,9 @@ class ThreadedPdfParserConfig(BaseModel):
     boundary_type: PdfPageBoundaryType = PdfPageBoundaryType.CROP_BOX
     render_config: RenderConfig | None = None
     page_content_config: ContentConfig | None = None
+    unload_completed_documents: bool = False
+    scheduling: PageScheduling = PageScheduling.FIFO
+    max_result_bytes: int = 0
 
 
 class PageParseResult:
@@ -1128,6 +1333,10 @@ class PageParseResult:
         self.doc_key: str = raw_result.doc_key
         self.page_number: int = raw_result.page_number + 1
         self.success: bool = raw_result.success
+        # True on the last result of its document handed out by the parser
+        self.document_completed: bool = raw_result.document_completed
+        # estimated bytes held by the result, counted against max_result_bytes
+        self.memory_bytes: int = raw_result.memory_bytes
 
         if self.success:
             self._page_decoder, _ = raw_result.get()
@@ -1142,6 +1351,13 @@ class PageParseResult:
             self.page_width = 0.0
             self.page_height = 0.0
 
+    @property
+    def render_threads(self) -> int:
+        """Blend2D worker threads the page was rasterized on (0: synchronously)."""
+        if self._render_config is None or not self.success:
+            return 0
+        return self._raw.render_threads
+
     @property
     def has_image(self) -> bool:
         """Whether get_image() can return a rendered image for this result."""
@@ -1221,6 +1437,16 @@ class PageParseResult:
         """Return structured timing data for this page parse."""
         return self._timings
 
+    def _to_native_bbox(self, bbox: BoundingBox) -> List[float]:
+        """Convert bbox to the native [left, bottom, right, top] page coordinates."""
+        bbox_bl = bbox.to_bottom_left_origin(page_height=self.page_height)
+        left = min(bbox_bl.l, bbox_bl.r)
+        right = max(bbox_bl.l, bbox_bl.r)
+        bottom = min(bbox_bl.b, bbox_bl.t)
+        top = max(bbox_bl.b, bbox_bl.t)
+
+        return [left, bottom, right, top]
+
     def intersects_with(
         self,
         *,
@@ -1234,35 +1460,92 @@ class PageParseResult:
         bbox may use top-left or bottom-left coordinates. Native code expects
         page coordinates with bottom-left origin as [left, bottom, right, top].
         """
-        bbox_bl = bbox.to_bottom_left_origin(page_height=self.page_height)
-        left = min(bbox_bl.l, bbox_bl.r)
-        right = max(bbox_bl.l, bbox_bl.r)
-        bottom = min(bbox_bl.b, bbox_bl.t)
-        top = max(bbox_bl.b, bbox_bl.t)
-
         return self._require_page_decoder().intersects_with(
-            [left, bottom, right, top],
+            self._to_native_bbox(bbox),
             chars=chars,
             shapes=shapes,
             bitmaps=bitmaps,
         )
 
+    def intersects_with_bboxes(
+        self,
+        *,
+        bboxes: Sequence[BoundingBox],
+        chars: bool = False,
+        shapes: bool = True,
+        bitmaps: bool = True,
+    ) -> List[bool]:
+        """Return for each bbox whether visible page content intersects it.
+
+        Same as intersects_with, but answers all bboxes in one native call
+        (without holding the GIL) from the spatial index of the page.
+        """
+        return self._require_page_decoder().intersects_with_bboxes(
+            [self._to_native_bbox(bbox) for bbox in bboxes],
+            chars=chars,
+            shapes=shapes,
+            bitmaps=bitmaps,
+        )
+
+    def get_cells_in_bbox(
+        self,
+        *,
+        bbox: BoundingBox,
+        cell_unit: TextCellUnit = TextCellUnit.WORD,
+        contained: bool = False,
+    ) -> List[int]:
+        """Return the indices of the cells that intersect (or lie within) bbox.
+
+        The indices refer to the char, word or line cells of the decoded page,
+        in their native order; chars are only available if they were kept.
+        """
+        return self.get_cells_in_bboxes(
+            bboxes=[bbox], cell_unit=cell_unit, contained=contained
+        )[0]
+
+    def get_cells_in_bboxes(
+        self,
+        *,
+        bboxes: Sequence[BoundingBox],
+        cell_unit: TextCellUnit = TextCellUnit.WORD,
+        contained: bool = False,
+    ) -> List[List[int]]:
+        """Return for each bbox the indices of the cells that intersect (or lie within) it."""
+        return self._require_page_decoder().get_cells_in_bboxes(
+            [self._to_native_bbox(bbox) for bbox in bboxes],
+            cell_unit=cell_unit.value,
+            contained=contained,
+        )
+
     def get_shape_lines(
         self,
         *,
         horizontal: bool = True,
         vertical: bool = True,
         tolerance: float = 1e-3,
+        bbox: Optional[BoundingBox] = None,
     ) -> List[BoundingBox]:
-        """Return visible horizontal and/or vertical stroked shape segments."""
-        return [
-            _to_bounding_box(tuple(bbox))
-            for bbox in self._require_page_decoder().get_shape_lines(
+        """Return visible horizontal and/or vertical stroked shape segments.
+
+        With bbox, only the segments that touch it are returned.
+        """
+        page_decoder = self._require_page_decoder()
+
+        if bbox is None:
+            lines = page_decoder.get_shape_lines(
                 horizontal=horizontal,
                 vertical=vertical,
                 tolerance=tolerance,
             )
-        ]
+        else:
+            lines = page_decoder.get_shape_lines_in_bbox(
+                self._to_native_bbox(bbox),
+                horizontal=horizontal,
+                vertical=vertical,
+                tolerance=tolerance,
+            )
+
+        return [_to_bounding_box(tuple(line)) for line in lines]
 
     def get_connected_shape_bounding_boxes(
         self,
@@ -1284,9 +1567,26 @@ class PageParseResult:
             )
         return _copy_render_config(self._render_config)
 
-    def _default_canvas_size(self) -> tuple[int, int]:
+    def _default_image_region(self) -> tuple[float, float, float, float] | None:
+        """Return the page area (bottom-left origin) shown by the default image,
+        or None if it shows the whole page."""
+        region = self._rendering_config().region
+        if not any(region):
+            return None
+        # the renderer clips the region to the page
+        return (
+            max(0.0, region[0]),
+            max(0.0, region[1]),
+            min(self.page_width, region[2]),
+            min(self.page_height, region[3]),
+        )
+
+    def _default_canvas_size(self) -> tuple[int, int] | None:
+        """Return the canvas size of the default image, or None if it only
+        shows a region of the page."""
         self._require_page_decoder()
-        self._rendering_config()
+        if self._default_image_region() is not None:
+            return None
         height, width, _ = self._raw.image_shape
         return width, height
 
@@ -1325,6 +1625,7 @@ class PageParseResult:
         render_config.scale = scale
         render_config.canvas_width = -1
         render_config.canvas_height = -1
+        render_config.region = [0.0, 0.0, 0.0, 0.0]
         raw_bytes, image_shape = page_decoder.render_image(render_config)
         if not raw_bytes:
             raise RuntimeError(
@@ -1332,6 +1633,26 @@ class PageParseResult:
             )
         return self._image_from_bytes(raw_bytes, image_shape)
 
+    def _render_region_at_scale(
+        self, scale: float, cropbox: BoundingBox
+    ) -> PILImage.Image:
+        """Rasterize only the cropbox, instead of cropping a full-page render."""
+        page_decoder = self._require_page_decoder()
+        render_config = self._rendering_config()
+        render_config.scale = scale
+        render_config.canvas_width = -1
+        render_config.canvas_height = -1
+
+        region = cropbox.to_bottom_left_origin(page_height=self.page_height)
+        render_config.region = [region.l, region.b, region.r, region.t]
+
+        raw_bytes, image_shape = page_decoder.render_image(render_config)
+        if not raw_bytes:
+            raise RuntimeError(
+                f"Rendered region is empty for page {self.page_number} of {self.doc_key}"
+            )
+        return self._image_from_bytes(raw_bytes, image_shape)
+
     def _render_image_at_canvas_size(
         self, canvas_size: tuple[int, int]
     ) -> PILImage.Image:
@@ -1339,6 +1660,7 @@ class PageParseResult:
         render_config = self._rendering_config()
         render_config.scale = -1.0
         render_config.canvas_width, render_config.canvas_height = canvas_size
+        render_config.region = [0.0, 0.0, 0.0, 0.0]
         raw_bytes, image_shape = page_decoder.render_image(render_config)
         if not raw_bytes:
             raise RuntimeError(
@@ -1347,22 +1669,33 @@ class PageParseResult:
         return self._image_from_bytes(raw_bytes, image_shape)
 
     def _crop_image(
-        self, image: PILImage.Image, cropbox: BoundingBox | None
+        self,
+        image: PILImage.Image,
+        cropbox: BoundingBox | None,
+        region: tuple[float, float, float, float] | None = None,
     ) -> PILImage.Image:
+        """Crop an image of the page, or of the region (bottom-left origin)
+        of the page it shows."""
         if cropbox is None:
             return image
-        if self.page_width <= 0 or self.page_height <= 0:
+        if region is None:
+            region = (0.0, 0.0, self.page_width, self.page_height)
+
+        x0, y0, x1, y1 = region
+        if x1 <= x0 or y1 <= y0:
             return image
 
-        cropbox_top_left = cropbox.to_top_left_origin(page_height=self.page_height)
-        x_scale = image.width / self.page_width
-        y_scale = image.height / self.page_height
+        cropbox_bottom_left = cropbox.to_bottom_left_origin(
+            page_height=self.page_height
+        )
+        x_scale = image.width / (x1 - x0)
+        y_scale = image.height / (y1 - y0)
 
-        left = max(0, round(cropbox_top_left.l * x_scale))
-        top = max(0, round(cropbox_top_left.t * y_scale))
-        right = min(image.width, round(cropbox_top_left.r * x_scale))
-        bottom = min(image.height, round(cropbox_top_left.b * y_scale))
-        return image.crop((left, top, right, bottom))
+        left = max(0, round((cropbox_bottom_left.l - x0) * x_scale))
+        top = max(0, round((y1 - cropbox_bottom_left.t) * y_scale))
+        right = min(image.width, round((cropbox_bottom_left.r - x0) * x_scale))
+        bottom = min(image.height, round((y1 - cropbox_bottom_left.b) * y_scale))
+        return image.crop((left, top, max(left, right), max(top, bottom)))
 
     def get_image(
         self,
@@ -1376,19 +1709,21 @@ class PageParseResult:
 
         if scale is None and canvas_size is None:
             image = self._get_default_image()
-            return self._crop_image(image, cropbox)
+            return self._crop_image(image, cropbox, self._default_image_region())
 
         if scale is not None:
             if scale <= 0:
                 raise ValueError(f"scale must be > 0, got {scale}")
             render_config = self._rendering_config()
-            if math.isclose(
+            if self._default_image_region() is None and math.isclose(
                 scale,
                 render_config.scale,
                 rel_tol=0.0,
                 abs_tol=self._scale_abs_tolerance(),
             ):
                 image = self._get_default_image()
+            elif cropbox is not None:
+                return self._render_region_at_scale(scale, cropbox)
             else:
                 image = self._render_image_at_scale(scale)
         else:
@@ -1421,6 +1756,8 @@ def _copy_render_config(src: RenderConfig) -> RenderConfig:
     dst.scale = src.scale
     dst.canvas_width = src.canvas_width
     dst.canvas_height = src.canvas_height
+    dst.render_threads = src.render_threads
+    dst.region = list(src.region)
     return dst
 
 
@@ -1439,6 +1776,12 @@ def _validate_render_config(src: RenderConfig) -> None:
         raise ValueError(
             "render_config.scale cannot be combined with canvas_width or canvas_height"
         )
+    if any(src.region) and not (
+        src.region[0] < src.region[2] and src.region[1] < src.region[3]
+    ):
+        raise ValueError("render_config.region must satisfy x0 < x1 and y0 < y1")
+    if src.render_threads < -1:
+        raise ValueError("render_config.render_threads must be >= 0 or -1")
 
 
 def _validated_render_config(src: RenderConfig) -> RenderConfig:
@@ -1482,6 +1825,9 @@ class DoclingThreadedPdfParser:
                 num_threads=parser_config.threads,
                 max_concurrent_results=parser_config.max_concurrent_results,
                 config=self._cpp_decode_config,
+                unload_completed_documents=parser_config.unload_completed_documents,
+                scheduling=PageScheduling(parser_config.scheduling).value,
+                max_result_bytes=parser_config.max_result_bytes,
             )
         else:
             self._parser = _threaded_pdf_renderer(
@@ -1490,6 +1836,9 @@ class DoclingThreadedPdfParser:
                 max_concurrent_results=parser_config.max_concurrent_results,
                 decode_config=self._cpp_decode_config,
                 render_config=parser_config.render_config,
+                unload_completed_documents=parser_config.unload_completed_documents,
+                scheduling=PageScheduling(parser_config.scheduling).value,
+                max_result_bytes=parser_config.max_result_bytes,
             )
 
     def load(
@@ -1500,6 +1849,9 @@ class DoclingThreadedPdfParser:
     ) -> str:
         """Load a document for parallel processing.
 
+        Documents can also be loaded while results are being consumed: once the
+        workers are running, the pages of the document are queued right away.
+
         Parameters:
             path_or_stream: File path or BytesIO object.
             password: Optional password for protected files.
@@ -1545,6 +1897,74 @@ class DoclingThreadedPdfParser:
         self._scheduled_page_counts[key] = self._parser.scheduled_number_of_pages(key)
         return key
 
+    def load_documents(
+        self,
+        paths_or_streams: Sequence[Union[str, Path, BytesIO]],
+        password: str | None = None,
+        page_numbers: Sequence[int] | None = None,
+    ) -> List[str]:
+        """Load several documents in parallel, without holding the GIL.
+
+        The worker threads are started first, so the pages of a document are
+        decoded as soon as that document is loaded, while the next ones are
+        still loading. The documents are loaded on up to `threads` loader
+        threads that run next to the workers, not on the workers themselves:
+        until the last document is loaded, up to twice `threads` threads may
+        be busy.
+
+        Parameters:
+            paths_or_streams: File paths or BytesIO objects.
+            password: Optional password, used for all documents.
+            page_numbers: Optional 1-indexed physical pages, used for all documents.
+
+        Returns:
+            List[str]: The document keys, in the order of paths_or_streams.
+
+        Raises:
+            RuntimeError: If a document could not be loaded, or repeats the key
+                of an earlier one; the other documents remain loaded.
+        """
+        keys: List[str] = []
+        sources: List[Union[str, bytes]] = []
+        for path_or_stream in paths_or_streams:
+            if isinstance(path_or_stream, str):
+                path_or_stream = Path(path_or_stream)
+
+            if isinstance(path_or_stream, Path):
+                keys.append(f"key={path_or_stream!s}")
+                sources.append(str(path_or_stream))
+            elif isinstance(path_or_stream, BytesIO):
+                path_or_stream.seek(0)
+                data = path_or_stream.read()
+                hash_val = hashlib.sha256(data, usedforsecurity=False).hexdigest()
+                keys.append(f"key={hash_val}")
+                sources.append(data)
+            else:
+                raise TypeError(
+                    f"Expected str, Path, or BytesIO, got {type(path_or_stream)}"
+                )
+
+        errors = self._parser.load_documents(
+            keys=keys,
+            sources=sources,
+            password=password,
+            page_numbers=list(page_numbers) if page_numbers is not None else None,
+        )
+
+        failures = []
+        for key, error in zip(keys, errors):
+            if error:
+                failures.append(f"{key}: {error}")
+                continue
+            self._page_counts[key] = self._parser.number_of_pages(key)
+            self._scheduled_page_counts[key] = self._parser.scheduled_number_of_pages(
+                key
+            )
+
+        if failures:
+            raise RuntimeError("Failed to load documents:\n" + "\n".join(failures))
+        return keys
+
     def page_count(self, doc_key: str) -> int:
         """Return the total page count for a loaded document."""
         if doc_key not in self._page_counts:
@@ -1558,7 +1978,7 @@ class DoclingThreadedPdfParser:
         return self._scheduled_page_counts[doc_key]
 
     def unload(self, doc_key: str) -> bool:
-        """Unload one document after threaded processing has completed."""
+        """Unload one document once all of its scheduled pages have been consumed."""
         unloaded = self._parser.unload_document(doc_key)
         self._page_counts.pop(doc_key, None)
         self._scheduled_page_counts.pop(doc_key, None)
@@ -1573,7 +1993,8 @@ class DoclingThreadedPdfParser:
     def has_tasks(self) -> bool:
         """Check if there are remaining tasks to consume.
 
-        On first call, builds the task queue and starts worker threads.
+        On first call, builds the task queue and starts worker threads. Documents
+        loaded afterwards are queued as they are loaded.
 
         Returns:
             bool: True if there are remaining results to consume.
@@ -1593,10 +2014,14 @@ class DoclingThreadedPdfParser:
         Returns:
             PageParseResult: Parsed page result with lazy page conversion and optional image access.
         """
-        return PageParseResult(
+        result = PageParseResult(
             self._parser.get_task(),
             boundary_type=self._parser_config.boundary_type,
             render_config=self._parser_config.render_config,
             content_config=self._content_config,
             batch_content_config=self._batch_content_config,
         )
+        if result.document_completed and self._parser_config.unload_completed_documents:
+            self._page_counts.pop(result.doc_key, None)
+            self._scheduled_page_counts.pop(result.doc_key, None)
+        return result
@@ -354,6 +354,7 @@ def _timing_csv_fieldnames() -> List[str]:
         "page_number",
         "success",
         "timing_total_s",
+        "timing_open_document_s",
         "timing_make_page_decoder_s",
         "timing_decode_page_s",
         "timing_create_word_cells_s",
@@ -381,6 +382,7 @@ def _timing_csv_row(
 
         timings = result.timings
         row["timing_total_s"] = timings.total_s
+        row["timing_open_document_s"] = timings.open_document_s
         row["timing_make_page_decoder_s"] = timings.make_page_decoder_s
         row["timing_decode_page_s"] = timings.decode_page_s
         row["timing_create_word_cells_s"] = timings.create_word_cells_s
@@ -3,7 +3,9 @@
 // std libraries
 #include <set>
 #include <map>
+#include <tuple>
 #include <mutex>
+#include <atomic>
 #include <iomanip>
 #include <vector>
 #include <assert.h>
@@ -37,6 +39,8 @@
 #include <qpdf/QPDF.hh>
 #include <qpdf/QPDFPageObjectHelper.hh>
 #include <qpdf/Buffer.hh>
+#include <qpdf/BufferInputSource.hh>
+#include <qpdf/QPDFTokenizer.hh>
 
 // code to locate pdf-resources (eg fonts)
 #include <resources.h>
@@ -53,8 +57,11 @@
 
 #include <parse/qpdf/to_json.h>
 #include <parse/qpdf/annots.h>
+#include <parse/qpdf/page_cost.h>
+#include <parse/pdf_decoders/stream_enums.h>
 #include <parse/qpdf/stream_instruction.h>
 #include <parse/qpdf/stream_decoder.h>
+#include <parse/qpdf/stream_lexer.h>
 
 // page-item
 #include <parse/page_item.h>
@@ -69,17 +76,20 @@
 #include <parse/page_items/page_widgets.h>
 #include <parse/page_items/page_hyperlink.h>
 #include <parse/page_items/page_hyperlinks.h>
+#include <parse/page_items/page_columns.h>
 #include <parse/page_items/render_instructions.h>
 
 // pdf-resource
 #include <parse/pdf_resource.h>
 #include <parse/pdf_resources/page_font/glyphs.h>
 #include <parse/pdf_resources/page_font/font_cid.h>
+#include <parse/pdf_resources/page_font/font_cid_table.h>
 #include <parse/pdf_resources/page_font/font_cids.h>
 #include <parse/pdf_resources/page_font/encoding.h>
 #include <parse/pdf_resources/page_font/encodings.h>
 #include <parse/pdf_resources/page_font/base_font.h>
 #include <parse/pdf_resources/page_font/base_fonts.h>
+#include <parse/pdf_resources/page_font/font_resources.h>
 #include <parse/pdf_resources/page_font/cmap_value.h>
 #include <parse/pdf_resources/page_font/cmap.h>
 #include <parse/pdf_resources/page_font/char_description.h>
@@ -87,6 +97,7 @@
 #include <parse/pdf_resources/page_font/embedded_font_program.h>
 
 #include <parse/pdf_resources/page_font.h>
+#include <parse/pdf_resources/document_fonts.h>
 #include <parse/pdf_resources/page_fonts.h>
 
 #include <parse/pdf_resources/page_grph.h>
@@ -115,7 +126,6 @@
 #include <parse/pdf_states/global.h>
 
 #include <parse/pdf_decoder.h>
-#include <parse/pdf_decoders/stream_enums.h>
 #include <parse/pdf_decoders/stream.h>
 #include <parse/pdf_decoders/page.h>
 #include <parse/pdf_decoders/document.h>
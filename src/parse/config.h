@@ -22,6 +22,13 @@ namespace pdflib
     int max_num_bitmaps = -1; // -1 means no cap
     double min_visible_clip_extent = DEFAULT_MIN_VISIBLE_CLIP_EXTENT;
 
+    // Device pixels per PDF unit at which the bitmaps will be rendered (i.e.
+    // render_config.scale). When set, /DCTDecode and /JPXDecode images are
+    // decoded at the largest power-of-two reduction (up to 1/8) that still
+    // covers their device-space size. -1 decodes at native resolution; keep
+    // it that way when the bitmaps are exported or rendered at a larger scale.
+    double bitmap_decode_scale = -1.0;
+
     bool create_word_cells = true;
     bool create_line_cells = true;
     bool enforce_same_font = true;      // word & line cell creation
@@ -44,6 +51,10 @@ namespace pdflib
     // decoding; the render pipeline turns it on.
     bool extract_font_programs = false;
 
+    // Tokenize content-streams with the native lexer (see stream_lexer.h)
+    // instead of QPDF's parseContentStream.
+    bool native_content_lexer = true;
+
     // threading
     bool do_thread_safe = true; // slight compute/memory overhead in single threaded case
     int release_native_memory_every_n_pages = 0; // 0 disables allocator trimming
@@ -76,6 +87,7 @@ namespace pdflib
     j["max_num_lines"] = max_num_lines;
     j["max_num_bitmaps"] = max_num_bitmaps;
     j["min_visible_clip_extent"] = min_visible_clip_extent;
+    j["bitmap_decode_scale"] = bitmap_decode_scale;
 
     j["create_word_cells"] = create_word_cells;
     j["create_line_cells"] = create_line_cells;
@@ -90,6 +102,7 @@ namespace pdflib
 
     j["populate_json_objects"] = populate_json_objects;
     j["extract_font_programs"] = extract_font_programs;
+    j["native_content_lexer"] = native_content_lexer;
     j["release_native_memory_every_n_pages"] = release_native_memory_every_n_pages;
 
     j["keep_glyphs"] = keep_glyphs;
@@ -111,6 +124,7 @@ namespace pdflib
     if(j.count("max_num_lines")) { max_num_lines = j["max_num_lines"]; }
     if(j.count("max_num_bitmaps")) { max_num_bitmaps = j["max_num_bitmaps"]; }
     if(j.count("min_visible_clip_extent")) { min_visible_clip_extent = j["min_visible_clip_extent"]; }
+    if(j.count("bitmap_decode_scale")) { bitmap_decode_scale = j["bitmap_decode_scale"]; }
 
     if(j.count("create_word_cells")) { create_word_cells = j["create_word_cells"]; }
     if(j.count("create_line_cells")) { create_line_cells = j["create_line_cells"]; }
@@ -125,6 +139,7 @@ namespace pdflib
 
     if(j.count("populate_json_objects")) { populate_json_objects = j["populate_json_objects"]; }
     if(j.count("extract_font_programs")) { extract_font_programs = j["extract_font_programs"]; }
+    if(j.count("native_content_lexer")) { native_content_lexer = j["native_content_lexer"]; }
     if(j.count("release_native_memory_every_n_pages")) { release_native_memory_every_n_pages = j["release_native_memory_every_n_pages"]; }
 
     if(j.count("keep_glyphs")) { keep_glyphs = j["keep_glyphs"]; }
@@ -173,6 +188,7 @@ namespace pdflib
        << std::setw(48) << "max_num_lines" << max_num_lines << "\n"
        << std::setw(48) << "max_num_bitmaps" << max_num_bitmaps << "\n"
        << std::setw(48) << "min_visible_clip_extent" << min_visible_clip_extent << "\n"
+       << std::setw(48) << "bitmap_decode_scale" << bitmap_decode_scale << "\n"
        << std::setw(48) << "create_word_cells" << (create_word_cells ? "true" : "false") << "\n"
        << std::setw(48) << "create_line_cells" << (create_line_cells ? "true" : "false") << "\n"
        << std::setw(48) << "enforce_same_font" << (enforce_same_font ? "true" : "false") << "\n"
@@ -182,6 +198,7 @@ namespace pdflib
        << std::setw(48) << "line_space_width_factor_for_merge_with_space" << line_space_width_factor_for_merge_with_space << "\n"
        << std::setw(48) << "populate_json_objects" << (populate_json_objects ? "true" : "false") << "\n"
        << std::setw(48) << "extract_font_programs" << (extract_font_programs ? "true" : "false") << "\n"
+       << std::setw(48) << "native_content_lexer" << (native_content_lexer ? "true" : "false") << "\n"
        << std::setw(48) << "release_native_memory_every_n_pages" << release_native_memory_every_n_pages << "\n"
        << std::setw(48) << "keep_glyphs" << (keep_glyphs ? "true" : "false") << "\n"
        << std::setw(48) << "keep_qpdf_warnings" << (keep_qpdf_warnings ? "true" : "false") << "\n";
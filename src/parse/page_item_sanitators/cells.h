@@ -16,6 +16,12 @@ namespace pdflib
 
     nlohmann::json to_records(page_item<PAGE_CELLS>& cells);
 
+    page_item<PAGE_CELLS> create_sanitised_cells(page_item<PAGE_CELLS>& cells);
+
+    // true if the line-cells of the config are contracted with the same
+    // rules as the sanitised cells, so they can be copied from the latter
+    bool has_sanitised_merge_rules(const decode_config& config);
+
     page_item<PAGE_CELLS> create_word_cells(page_item<PAGE_CELLS>& cells,
 					       const decode_config& config);
 
@@ -40,6 +46,20 @@ namespace pdflib
     
   private:
 
+    // same text and font, and all corners closer than eps
+    bool is_duplicate_cell(page_item<PAGE_CELL>& cell_i,
+			   page_item<PAGE_CELL>& cell_j,
+			   double eps);
+
+    // for each cell i, the first j>i with |r_y0(i)-r_y0(j)|>eps (or #-cells)
+    std::vector<int> find_line_ends(page_item<PAGE_CELLS>& cells, double eps);
+
+    // merge rules of the sanitised cells
+    constexpr static double sanitised_horizontal_cell_tolerance = 1.0;
+    constexpr static bool   sanitised_enforce_same_font = true;
+    constexpr static double sanitised_space_width_factor_for_merge = 1.0;
+    constexpr static double sanitised_space_width_factor_for_merge_with_space = 0.33;
+
     bool applicable_for_merge(page_item<PAGE_CELL>& cell_i,
 			      page_item<PAGE_CELL>& cell_j,
 			      bool enforce_same_font,
@@ -118,8 +138,8 @@ namespace pdflib
 	  item["text"] = cell.text;
 	  item["orig"] = cell.text;
 
-	  item["font_key"] = cell.font_key;
-	  item["font_name"] = cell.font_name;
+	  item["font_key"] = cell.get_font_key();
+	  item["font_name"] = cell.get_font_name();
 
 	  item["rendering_mode"] = cell.rendering_mode;
 
@@ -133,6 +153,32 @@ namespace pdflib
     return result;
   }
   
+  page_item<PAGE_CELLS> page_item_sanitator<PAGE_CELLS>::create_sanitised_cells(page_item<PAGE_CELLS>& char_cells)
+  {
+    LOG_S(INFO) << __FUNCTION__;
+
+    // do a deep copy
+    page_item<PAGE_CELLS> cells;
+    cells = char_cells;
+
+    sanitize_bbox(cells,
+		  sanitised_horizontal_cell_tolerance,
+		  sanitised_enforce_same_font,
+		  sanitised_space_width_factor_for_merge,
+		  sanitised_space_width_factor_for_merge_with_space,
+		  false);
+
+    return cells;
+  }
+
+  bool page_item_sanitator<PAGE_CELLS>::has_sanitised_merge_rules(const decode_config& config)
+  {
+    return (config.horizontal_cell_tolerance==sanitised_horizontal_cell_tolerance and
+	    config.enforce_same_font==sanitised_enforce_same_font and
+	    config.line_space_width_factor_for_merge==sanitised_space_width_factor_for_merge and
+	    config.line_space_width_factor_for_merge_with_space==sanitised_space_width_factor_for_merge_with_space);
+  }
+
   page_item<PAGE_CELLS> page_item_sanitator<PAGE_CELLS>::create_word_cells(page_item<PAGE_CELLS>& char_cells,
 									const decode_config& config)
   {
@@ -161,19 +207,15 @@ namespace pdflib
 		  space_width_factor_for_merge_with_space,
 		  true);
 
-    // remove the space cells that acted as word-boundary barriers
-    auto itr = word_cells.begin();
-    while(itr!=word_cells.end())
-      {
-	if(utils::string::is_space(itr->text))
-	  {
-	    itr = word_cells.erase(itr);
-	  }
-	else
-	  {
-	    itr++;
-	  }
-      }
+    // remove the space cells that acted as word-boundary barriers (in one
+    // pass, erasing them one by one is quadratic on text-dense pages)
+    {
+      auto it = std::remove_if(word_cells.begin(), word_cells.end(),
+			       [](const page_item<PAGE_CELL>& cell) {
+				 return utils::string::is_space(cell.text);
+			       });
+      word_cells.erase(it, word_cells.end());
+    }
 
     LOG_S(INFO) << "#-word cells: " << word_cells.size();
 
@@ -229,7 +271,7 @@ namespace pdflib
 		    continue;
 		  }
 		
-		if(cells[i].font_name==cells[j].font_name and
+		if(cells[i].has_same_font_name(cells[j]) and
 		   cells[i].text==cells[j].text and
 		   utils::values::distance(cells[i].r_x0, cells[i].r_y0, cells[j].r_x0, cells[j].r_y0)<eps and
 		   utils::values::distance(cells[i].r_x1, cells[i].r_y1, cells[j].r_x1, cells[j].r_y1)<eps and
@@ -284,12 +326,7 @@ namespace pdflib
 	    continue;
 	  }
 		
-	if(cells[i].font_name==cells[j].font_name and
-	   cells[i].text==cells[j].text and
-	   utils::values::distance(cells[i].r_x0, cells[i].r_y0, cells[j].r_x0, cells[j].r_y0)<eps and
-	   utils::values::distance(cells[i].r_x1, cells[i].r_y1, cells[j].r_x1, cells[j].r_y1)<eps and
-	   utils::values::distance(cells[i].r_x2, cells[i].r_y2, cells[j].r_x2, cells[j].r_y2)<eps and
-	   utils::values::distance(cells[i].r_x3, cells[i].r_y3, cells[j].r_x3, cells[j].r_y3)<eps)
+	if(is_duplicate_cell(cells[i], cells[j], eps))
 	  {
 	    LOG_S(WARNING) << "removing duplicate char with text: '" << cells[j].text << "' "
 			   << "with r_0: (" << cells[i].r_x0 << ", " << cells[i].r_y0 << ") "
@@ -304,40 +341,129 @@ namespace pdflib
     cells.remove_inactive_cells();
   }
 
+  bool page_item_sanitator<PAGE_CELLS>::is_duplicate_cell(page_item<PAGE_CELL>& cell_i,
+							  page_item<PAGE_CELL>& cell_j,
+							  double eps)
+  {
+    return (cell_i.has_same_font_name(cell_j) and
+	    cell_i.text==cell_j.text and
+	    utils::values::distance(cell_i.r_x0, cell_i.r_y0, cell_j.r_x0, cell_j.r_y0)<eps and
+	    utils::values::distance(cell_i.r_x1, cell_i.r_y1, cell_j.r_x1, cell_j.r_y1)<eps and
+	    utils::values::distance(cell_i.r_x2, cell_i.r_y2, cell_j.r_x2, cell_j.r_y2)<eps and
+	    utils::values::distance(cell_i.r_x3, cell_i.r_y3, cell_j.r_x3, cell_j.r_y3)<eps);
+  }
+
+  std::vector<int> page_item_sanitator<PAGE_CELLS>::find_line_ends(page_item<PAGE_CELLS>& cells, double eps)
+  {
+    int num = cells.size();
+
+    std::vector<double> y0(num);
+
+    bool finite=true;
+    for(int i=0; i<num; i++)
+      {
+	y0[i] = cells[i].r_y0;
+	finite = (finite and std::isfinite(y0[i]));
+      }
+
+    std::vector<int> ends(num, num);
+
+    if(not finite) // the differences are not ordered, scan as before
+      {
+	for(int i=0; i<num; i++)
+	  {
+	    for(int j=i+1; j<num; j++)
+	      {
+		if(std::abs(y0[i]-y0[j])>eps)
+		  {
+		    ends[i] = j;
+		    break;
+		  }
+	      }
+	  }
+
+	return ends;
+      }
+
+    // The first j>i with y0[j]-y0[i]>eps is a (strict) running maximum of
+    // y0[i+1:], so it is found by a binary search on the stack of running
+    // maxima. The same for y0[i]-y0[j]>eps with the running minima.
+    for(double sign:{1.0, -1.0})
+      {
+	std::vector<int> stack; // nearest index at the back
+
+	for(int i=num-1; i>=0; i--)
+	  {
+	    auto itr = std::partition_point(stack.begin(), stack.end(),
+					     [&](int j) { return sign*(y0[j]-y0[i])>eps; });
+
+	    if(itr!=stack.begin())
+	      {
+		ends[i] = std::min(ends[i], *(itr-1));
+	      }
+
+	    while(stack.size()>0 and sign*(y0[stack.back()]-y0[i])<=0.0)
+	      {
+		stack.pop_back();
+	      }
+	    stack.push_back(i);
+	  }
+      }
+
+    return ends;
+  }
+
   void page_item_sanitator<PAGE_CELLS>::remove_duplicate_cells(page_item<PAGE_CELLS>& cells, double eps, bool same_line)
   {
-    for(int i=0; i<cells.size(); i++)
+    int num = cells.size();
+
+    // with same_line, cell i is only compared up to the first cell that is
+    // not on its line (the cells are in reading order)
+    std::vector<int> ends(num, num);
+    if(same_line)
+      {
+	ends = find_line_ends(cells, eps);
+      }
+
+    // duplicates have their first corner closer than eps
+    utils::spatial::grid_index index(eps);
+    for(int i=0; i<num; i++)
+      {
+	index.insert(i, cells[i].r_x0, cells[i].r_y0);
+      }
+    index.build();
+
+    std::vector<uint32_t> candidates;
+    for(int i=0; i<num; i++)
       {
 	if(not cells[i].active)
 	  {
 	    continue;
 	  }
 
-	for(int j=i+1; j<cells.size(); j++)
-	  {	
-	    if(same_line and std::abs(cells[i].r_y0-cells[j].r_y0)>eps)
+	index.query(cells[i].r_x0-eps, cells[i].r_y0-eps,
+		    cells[i].r_x0+eps, cells[i].r_y0+eps, candidates);
+
+	for(int j:candidates) // sorted
+	  {
+	    if(j<=i or not cells[j].active)
 	      {
-		break;
+		continue;
 	      }
 
-	    if(not cells[j].active)
+	    if(j>=ends[i])
 	      {
-		continue;
+		break;
 	      }
 
-	    if(cells[i].font_name==cells[j].font_name and
-	       cells[i].text==cells[j].text and
-	       utils::values::distance(cells[i].r_x0, cells[i].r_y0, cells[j].r_x0, cells[j].r_y0)<eps and
-	       utils::values::distance(cells[i].r_x1, cells[i].r_y1, cells[j].r_x1, cells[j].r_y1)<eps and
-	       utils::values::distance(cells[i].r_x2, cells[i].r_y2, cells[j].r_x2, cells[j].r_y2)<eps and
-	       utils::values::distance(cells[i].r_x3, cells[i].r_y3, cells[j].r_x3, cells[j].r_y3)<eps)
+	    if(is_duplicate_cell(cells[i], cells[j], eps))
 	      {
 		LOG_S(WARNING) << "removing duplicate char with text: '" << cells[j].text << "' "
 			       << "with r_0: (" << cells[i].r_x0 << ", " << cells[i].r_y0 << ") "
 			       << "with r_2: (" << cells[i].r_x2 << ", " << cells[i].r_y2 << ") "
 			       << "with r'_0: (" << cells[j].r_x0 << ", " << cells[j].r_y0 << ") "
 			       << "with r'_2: (" << cells[j].r_x2 << ", " << cells[j].r_y2 << ") ";
-	    
+
 		cells[j].active = false;
 	      }
 	  }
@@ -345,7 +471,7 @@ namespace pdflib
 
     cells.remove_inactive_cells();
   }
-  
+
   void page_item_sanitator<PAGE_CELLS>::sanitize_text(page_item<PAGE_CELLS>& cells)
   {
     for(int i=0; i<cells.size(); i++)
@@ -419,7 +545,7 @@ namespace pdflib
 	return false;
       }
 
-    if(enforce_same_font and cell_i.font_name!=cell_j.font_name)
+    if(enforce_same_font and not cell_i.has_same_font_name(cell_j))
       {
 	// Exception: ligature glyphs are often encoded in a different font than
 	// the surrounding text, so allow merging when either cell is a ligature.
@@ -501,8 +627,7 @@ namespace pdflib
 		// merges are not blocked by the ligature font.
 		if(i_is_ligature and not j_is_ligature)
 		  {
-		    cells[i].font_name = cells[j].font_name;
-		    cells[i].font_key  = cells[j].font_key;
+		    cells[i].set_font_name_and_key(cells[j]);
 		  }
 		// Flag resets based only on whether the just-absorbed cell (j) is a
 		// raw ligature. This ensures extra tolerance lasts exactly one merge
@@ -518,8 +643,7 @@ namespace pdflib
 		// If cell_j was the ligature side, adopt cell_i's font.
 		if(j_is_ligature and not i_is_ligature)
 		  {
-		    cells[j].font_name = cells[i].font_name;
-		    cells[j].font_key  = cells[i].font_key;
+		    cells[j].set_font_name_and_key(cells[i]);
 		  }
 		cells[j].last_merged_cell_was_ligature = utils::string::is_ligature(cells[i].text);
 		cells[i].active = false;
@@ -582,8 +706,7 @@ namespace pdflib
 		// If cell_j was the ligature side, adopt cell_i's font.
 		if(j_is_ligature and not i_is_ligature)
 		  {
-		    cells[j].font_name = cells[i].font_name;
-		    cells[j].font_key  = cells[i].font_key;
+		    cells[j].set_font_name_and_key(cells[i]);
 		  }
 			// Flag resets based only on whether the just-absorbed cell (i) is a
 		// raw ligature — same one-step propagation semantics as L2R pass.
@@ -633,7 +756,7 @@ namespace pdflib
 		    continue;
 		  }
 
-		if(enforce_same_font and cells[i].font_name!=cells[j].font_name)
+		if(enforce_same_font and not cells[i].has_same_font_name(cells[j]))
 		  {
 		    continue;
 		  }
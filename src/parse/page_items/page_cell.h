@@ -6,6 +6,55 @@
 namespace pdflib
 {
 
+  // Font and encoding names of a cell. They are the same for all cells
+  // drawn with one font, so the cells share a single (immutable) entry
+  // instead of carrying their own copies of the strings.
+  class page_cell_font
+  {
+  public:
+
+    page_cell_font();
+    page_cell_font(std::string enc_name_,
+                   std::string font_enc_,
+                   std::string font_key_,
+                   std::string font_name_);
+
+    ~page_cell_font();
+
+    static const std::shared_ptr<const page_cell_font>& empty();
+
+  public:
+
+    std::string enc_name;
+
+    std::string font_enc;
+    std::string font_key;
+
+    std::string font_name;
+  };
+
+  page_cell_font::page_cell_font()
+  {}
+
+  page_cell_font::page_cell_font(std::string enc_name_,
+                                 std::string font_enc_,
+                                 std::string font_key_,
+                                 std::string font_name_):
+    enc_name(enc_name_),
+    font_enc(font_enc_),
+    font_key(font_key_),
+    font_name(font_name_)
+  {}
+
+  page_cell_font::~page_cell_font()
+  {}
+
+  const std::shared_ptr<const page_cell_font>& page_cell_font::empty()
+  {
+    static const std::shared_ptr<const page_cell_font> empty_font = std::make_shared<const page_cell_font>();
+    return empty_font;
+  }
+
   template<>
   class page_item<PAGE_CELL>
   {
@@ -14,6 +63,25 @@ namespace pdflib
     page_item();
     ~page_item();
 
+    const std::string& get_enc_name() const;
+    const std::string& get_font_enc() const;
+    const std::string& get_font_key() const;
+    const std::string& get_font_name() const;
+
+    const std::shared_ptr<const page_cell_font>& get_font() const;
+
+    void set_font(std::shared_ptr<const page_cell_font> font_);
+
+    void set_font(std::string enc_name_,
+                  std::string font_enc_,
+                  std::string font_key_,
+                  std::string font_name_);
+
+    // take the font-name and font-key of `other`, keep the encodings
+    void set_font_name_and_key(const page_item<PAGE_CELL>& other);
+
+    bool has_same_font_name(const page_item<PAGE_CELL>& other) const;
+
     nlohmann::json get();
     bool init_from(nlohmann::json& data);
 
@@ -71,13 +139,9 @@ namespace pdflib
     //std::vector<std::string> chars;
     //std::vector<double>      widths;
 
-    std::string enc_name;
-
-    std::string font_enc;
-    std::string font_key;
-
-    std::string font_name;
-    double      font_size;
+    // enc_name, font_enc, font_key and font_name (see get_font)
+    std::shared_ptr<const page_cell_font> font;
+    double font_size;
 
     bool italic;
     bool bold;
@@ -101,12 +165,67 @@ namespace pdflib
 
   page_item<PAGE_CELL>::page_item():
     active(true),
-    left_to_right(true)
+    left_to_right(true),
+    font(page_cell_font::empty())
     {}
 
   page_item<PAGE_CELL>::~page_item()
   {}
 
+  const std::string& page_item<PAGE_CELL>::get_enc_name() const
+  {
+    return font->enc_name;
+  }
+
+  const std::string& page_item<PAGE_CELL>::get_font_enc() const
+  {
+    return font->font_enc;
+  }
+
+  const std::string& page_item<PAGE_CELL>::get_font_key() const
+  {
+    return font->font_key;
+  }
+
+  const std::string& page_item<PAGE_CELL>::get_font_name() const
+  {
+    return font->font_name;
+  }
+
+  const std::shared_ptr<const page_cell_font>& page_item<PAGE_CELL>::get_font() const
+  {
+    return font;
+  }
+
+  void page_item<PAGE_CELL>::set_font(std::shared_ptr<const page_cell_font> font_)
+  {
+    font = font_? font_ : page_cell_font::empty();
+  }
+
+  void page_item<PAGE_CELL>::set_font(std::string enc_name_,
+                                      std::string font_enc_,
+                                      std::string font_key_,
+                                      std::string font_name_)
+  {
+    font = std::make_shared<const page_cell_font>(enc_name_, font_enc_, font_key_, font_name_);
+  }
+
+  void page_item<PAGE_CELL>::set_font_name_and_key(const page_item<PAGE_CELL>& other)
+  {
+    if(font==other.font or
+       (font->font_name==other.font->font_name and font->font_key==other.font->font_key))
+      {
+        return;
+      }
+
+    set_font(font->enc_name, font->font_enc, other.font->font_key, other.font->font_name);
+  }
+
+  bool page_item<PAGE_CELL>::has_same_font_name(const page_item<PAGE_CELL>& other) const
+  {
+    return (font==other.font or font->font_name==other.font->font_name);
+  }
+
   std::vector<std::string> page_item<PAGE_CELL>::header = {
     "x0",
     "y0",
@@ -203,11 +322,11 @@ namespace pdflib
 
       cell.push_back(utils::values::round(space_width)); //14
 
-      cell.push_back(enc_name); // 15
+      cell.push_back(font->enc_name); // 15
 
-      cell.push_back(font_enc); // 16
-      cell.push_back(font_key); // 17
-      cell.push_back(font_name); // 18
+      cell.push_back(font->font_enc); // 16
+      cell.push_back(font->font_key); // 17
+      cell.push_back(font->font_name); // 18
 
       cell.push_back(widget); // 19
       cell.push_back(left_to_right); // 20
@@ -247,11 +366,10 @@ namespace pdflib
 
         space_width = data.at(14).get<double>();
 
-        enc_name = data.at(15).get<std::string>();
-
-        font_enc = data.at(16).get<std::string>();
-        font_key = data.at(17).get<std::string>();
-        font_name = data.at(18).get<std::string>();
+        set_font(data.at(15).get<std::string>(),  // enc_name
+                 data.at(16).get<std::string>(),  // font_enc
+                 data.at(17).get<std::string>(),  // font_key
+                 data.at(18).get<std::string>()); // font_name
 
 	widget = data.at(19).get<bool>();
 	left_to_right = data.at(20).get<bool>();
@@ -25,6 +25,10 @@ namespace pdflib
 
     void   clear();
     size_t size();
+    size_t capacity();
+
+    // grow the capacity to at least `n` cells (no-op if it is larger)
+    void reserve(size_t n);
 
     void push_back(page_item<PAGE_CELL>& cell);
 
@@ -45,9 +49,7 @@ namespace pdflib
 
   page_item<PAGE_CELLS>::page_item():
     cells(0) // 0 elements
-  {
-    cells.reserve(1000000); // Reserve space for 1M elements
-  }
+  {}
 
   page_item<PAGE_CELLS>::~page_item()
   {}
@@ -124,6 +126,16 @@ namespace pdflib
     return cells.size();
   }
 
+  size_t page_item<PAGE_CELLS>::capacity()
+  {
+    return cells.capacity();
+  }
+
+  void page_item<PAGE_CELLS>::reserve(size_t n)
+  {
+    cells.reserve(n);
+  }
+
   void page_item<PAGE_CELLS>::push_back(page_item<PAGE_CELL>& cell)
   {
     cells.push_back(cell);
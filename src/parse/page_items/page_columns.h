@@ -0,0 +1,210 @@
+//-*-C++-*-
+
+#ifndef PAGE_ITEM_COLUMNS_H
+#define PAGE_ITEM_COLUMNS_H
+
+namespace pdflib
+{
+
+  // Columnar copy of page-cells: one contiguous array per attribute, so the
+  // cells can be handed over to Python (buffer protocol) in one go instead
+  // of attribute by attribute.
+  //
+  // The text of cell i is text[text_offsets[i]:text_offsets[i+1]] (UTF-8),
+  // its font is font_keys[font_ids[i]] and font_names[font_ids[i]].
+  class page_cell_columns
+  {
+  public:
+
+    constexpr static uint8_t FLAG_LEFT_TO_RIGHT = 1;
+    constexpr static uint8_t FLAG_WIDGET        = 2;
+
+  public:
+
+    page_cell_columns();
+    page_cell_columns(page_item<PAGE_CELLS>& cells);
+
+    ~page_cell_columns();
+
+    size_t size() const;
+
+  public:
+
+    std::vector<double>  rect;            // size x 8: r_x0, r_y0, r_x1, r_y1, r_x2, r_y2, r_x3, r_y3
+    std::vector<int32_t> font_ids;        // index in the font-table
+    std::vector<int32_t> rendering_mode;
+    std::vector<uint8_t> flags;           // FLAG_LEFT_TO_RIGHT | FLAG_WIDGET
+
+    std::string          text;
+    std::vector<int64_t> text_offsets;    // size+1
+
+    // font-table
+    std::vector<std::string> font_keys;
+    std::vector<std::string> font_names;
+  };
+
+  page_cell_columns::page_cell_columns():
+    text_offsets({0})
+  {}
+
+  page_cell_columns::page_cell_columns(page_item<PAGE_CELLS>& cells):
+    text_offsets({0})
+  {
+    rect.reserve(8*cells.size());
+    font_ids.reserve(cells.size());
+    rendering_mode.reserve(cells.size());
+    flags.reserve(cells.size());
+    text_offsets.reserve(cells.size()+1);
+
+    // the cells of one font mostly share their font-entry, look up the
+    // names only once per entry
+    std::unordered_map<const page_cell_font*, int32_t> font_ptr_to_id;
+    std::map<std::pair<std::string, std::string>, int32_t> font_name_to_id;
+
+    size_t text_size = 0;
+    for(auto& cell:cells)
+      {
+        text_size += cell.text.size();
+      }
+    text.reserve(text_size);
+
+    for(auto& cell:cells)
+      {
+        rect.insert(rect.end(), {cell.r_x0, cell.r_y0, cell.r_x1, cell.r_y1,
+                                 cell.r_x2, cell.r_y2, cell.r_x3, cell.r_y3});
+
+        const page_cell_font* font = cell.get_font().get();
+
+        auto itr = font_ptr_to_id.find(font);
+        if(itr==font_ptr_to_id.end())
+          {
+            std::pair<std::string, std::string> name(font->font_key, font->font_name);
+
+            auto jtr = font_name_to_id.find(name);
+            if(jtr==font_name_to_id.end())
+              {
+                jtr = font_name_to_id.insert({name, font_keys.size()}).first;
+
+                font_keys.push_back(font->font_key);
+                font_names.push_back(font->font_name);
+              }
+
+            itr = font_ptr_to_id.insert({font, jtr->second}).first;
+          }
+        font_ids.push_back(itr->second);
+
+        rendering_mode.push_back(cell.rendering_mode);
+
+        flags.push_back((cell.left_to_right? FLAG_LEFT_TO_RIGHT : 0) |
+                        (cell.widget? FLAG_WIDGET : 0));
+
+        text += cell.text;
+        text_offsets.push_back(text.size());
+      }
+  }
+
+  page_cell_columns::~page_cell_columns()
+  {}
+
+  size_t page_cell_columns::size() const
+  {
+    return font_ids.size();
+  }
+
+  // Columnar copy of page-shapes. The points of shape i are
+  // x/y[point_offsets[i]:point_offsets[i+1]] and its (shape-local) subpath
+  // indices are i[index_offsets[i]:index_offsets[i+1]], as in get_i().
+  class page_shape_columns
+  {
+  public:
+
+    page_shape_columns();
+    page_shape_columns(page_item<PAGE_SHAPES>& shapes);
+
+    ~page_shape_columns();
+
+    size_t size() const;
+
+  public:
+
+    std::vector<double>  x;
+    std::vector<double>  y;
+    std::vector<int64_t> point_offsets; // size+1
+
+    std::vector<int32_t> i;
+    std::vector<int64_t> index_offsets; // size+1
+
+    // graphics state
+    std::vector<uint8_t> has_graphics_state;
+    std::vector<double>  line_width;
+    std::vector<double>  miter_limit;
+    std::vector<int32_t> line_cap;
+    std::vector<int32_t> line_join;
+    std::vector<double>  dash_phase;
+    std::vector<double>  flatness;
+
+    std::vector<double>  dash_array;
+    std::vector<int64_t> dash_offsets;  // size+1
+
+    std::vector<int32_t> rgb_stroking;  // size x 3
+    std::vector<int32_t> rgb_filling;   // size x 3
+  };
+
+  page_shape_columns::page_shape_columns():
+    point_offsets({0}),
+    index_offsets({0}),
+    dash_offsets({0})
+  {}
+
+  page_shape_columns::page_shape_columns(page_item<PAGE_SHAPES>& shapes):
+    point_offsets({0}),
+    index_offsets({0}),
+    dash_offsets({0})
+  {
+    size_t num_points = 0;
+    for(auto& shape:shapes)
+      {
+        num_points += shape.get_x().size();
+      }
+
+    x.reserve(num_points);
+    y.reserve(num_points);
+
+    for(auto& shape:shapes)
+      {
+        x.insert(x.end(), shape.get_x().begin(), shape.get_x().end());
+        y.insert(y.end(), shape.get_y().begin(), shape.get_y().end());
+        point_offsets.push_back(x.size());
+
+        i.insert(i.end(), shape.get_i().begin(), shape.get_i().end());
+        index_offsets.push_back(i.size());
+
+        has_graphics_state.push_back(shape.get_has_graphics_state()? 1 : 0);
+        line_width.push_back(shape.get_line_width());
+        miter_limit.push_back(shape.get_miter_limit());
+        line_cap.push_back(shape.get_line_cap());
+        line_join.push_back(shape.get_line_join());
+        dash_phase.push_back(shape.get_dash_phase());
+        flatness.push_back(shape.get_flatness());
+
+        dash_array.insert(dash_array.end(), shape.get_dash_array().begin(), shape.get_dash_array().end());
+        dash_offsets.push_back(dash_array.size());
+
+        rgb_stroking.insert(rgb_stroking.end(),
+                            shape.get_rgb_stroking_ops().begin(), shape.get_rgb_stroking_ops().end());
+        rgb_filling.insert(rgb_filling.end(),
+                           shape.get_rgb_filling_ops().begin(), shape.get_rgb_filling_ops().end());
+      }
+  }
+
+  page_shape_columns::~page_shape_columns()
+  {}
+
+  size_t page_shape_columns::size() const
+  {
+    return line_width.size();
+  }
+
+}
+
+#endif
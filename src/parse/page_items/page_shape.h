@@ -57,6 +57,9 @@ namespace pdflib
 
     size_t size();
 
+    // heap bytes held by the shape, for the memory budget of its page
+    size_t estimate_memory_bytes() const;
+
     std::pair<double, double> front();
     std::pair<double, double> back();
 
@@ -279,6 +282,13 @@ namespace pdflib
     return x.size();
   }
 
+  size_t page_item<PAGE_SHAPE>::estimate_memory_bytes() const
+  {
+    return i.capacity()*sizeof(int)
+      + (x.capacity() + y.capacity() + seg_x.capacity() + seg_y.capacity() + dash_array.capacity())*sizeof(double)
+      + seg_ops.capacity()*sizeof(shape_segment_op);
+  }
+
   std::pair<double, double> page_item<PAGE_SHAPE>::front()
   {
     //assert(x.size()>0);
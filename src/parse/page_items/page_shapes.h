@@ -26,6 +26,8 @@ namespace pdflib
     void clear();
     size_t size();
 
+    size_t estimate_memory_bytes() const;
+
     page_item<PAGE_SHAPE>& back();
     void push_back(page_item<PAGE_SHAPE>& shape);
 
@@ -114,6 +116,18 @@ namespace pdflib
     return shapes.size();
   }
 
+  size_t page_item<PAGE_SHAPES>::estimate_memory_bytes() const
+  {
+    size_t result = shapes.capacity()*sizeof(page_item<PAGE_SHAPE>);
+
+    for(const auto& shape : shapes)
+      {
+        result += shape.estimate_memory_bytes();
+      }
+
+    return result;
+  }
+
   page_item<PAGE_SHAPE>& page_item<PAGE_SHAPES>::back()
   {
     if(shapes.size()==0)
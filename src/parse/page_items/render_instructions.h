@@ -9,6 +9,7 @@
 #include <vector>
 #include <array>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include <parse/enums.h>
@@ -709,6 +710,11 @@ namespace pdflib
       return text_instructions;
     }
 
+    // Heap bytes held by the instructions, mostly the decoded pixels of the
+    // bitmaps (a buffer drawn several times is counted once). The embedded
+    // fonts are shared with the font cache and not counted.
+    size_t estimate_memory_bytes() const;
+
     // render method
     template<typename renderer_type>
     void iterate_over_instructions(renderer_type& renderer);
@@ -765,6 +771,41 @@ namespace pdflib
     shape_instructions.push_back(std::move(instr));
   }
 
+  inline size_t pdf_render_instructions::estimate_memory_bytes() const
+  {
+    size_t result = instructions.capacity()*sizeof(instruction_type)
+      + text_instructions.capacity()*sizeof(text_instruction_type)
+      + widget_instructions.capacity()*sizeof(text_widget_instruction_type)
+      + bitmap_instructions.capacity()*sizeof(bitmap_instruction_type)
+      + shape_instructions.capacity()*sizeof(shape_instruction_type);
+
+    std::set<const void*> counted;
+    for(const auto& instr : bitmap_instructions)
+      {
+        for(const auto* pixels : {&instr.get_data(), &instr.get_alpha_data()})
+          {
+            if(*pixels and counted.insert(pixels->get()).second)
+              {
+                result += (*pixels)->capacity();
+              }
+          }
+      }
+
+    for(const auto& instr : shape_instructions)
+      {
+        result += instr.get_subpaths().capacity()*sizeof(shape_subpath)
+          + instr.get_dash_array().capacity()*sizeof(double);
+
+        for(const auto& subpath : instr.get_subpaths())
+          {
+            result += (subpath.get_px().capacity() + subpath.get_py().capacity())*sizeof(double)
+              + subpath.get_ops().capacity()*sizeof(shape_segment_op);
+          }
+      }
+
+    return result;
+  }
+
   template<typename renderer_type>
   void pdf_render_instructions::iterate_over_instructions(renderer_type& renderer)
   {
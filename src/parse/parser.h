@@ -298,7 +298,7 @@ namespace plib
 		      << "(" << cell.r_x1 << ", " << cell.r_y1 << ") "
 		      << "(" << cell.r_x2 << ", " << cell.r_y2 << ") "
 		      << "(" << cell.r_x3 << ", " << cell.r_y3 << ")"
-		      << "\t" << cell.font_key << " " << cell.text << "\n";
+		      << "\t" << cell.get_font_key() << " " << cell.text << "\n";
 	  }
       };
 
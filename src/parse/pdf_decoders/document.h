@@ -54,6 +54,17 @@ namespace pdflib
                                  const decode_config& config);
     page_decoder_ptr make_thread_safe_page_decoder(int page_number,
                                                    bool keep_qpdf_warnings);
+    page_decoder_ptr make_thread_safe_page_decoder(int page_number,
+                                                   std::shared_ptr<QPDF> thread_qpdf_document);
+
+    // Open a private QPDF document over the shared (immutable) buffer. The
+    // returned document must only be used by one thread at a time, and can
+    // be reused for all pages that thread decodes.
+    std::shared_ptr<QPDF> open_thread_safe_document(bool keep_qpdf_warnings);
+
+    // Cheap estimate of the decode cost of a page (see page_cost), read from
+    // the dictionaries of this decoder's own QPDF document.
+    double estimate_page_cost(int page_number);
     
     // New: Direct access to page decoders (typed API)
     bool has_page_decoder(int page_number);
@@ -67,11 +78,16 @@ namespace pdflib
 
   private:
 
-    std::pair<int, std::shared_ptr<std::string> > get_thread_safe_page_buffer(
-      int page_ind,
-      bool keep_qpdf_warnings);
+    // The document-level annotations are only extracted on first use, and
+    // each part (acroform, metadata, language, outline) on its own: getting
+    // the table of contents does not walk the /AcroForm tree.
+    template<typename extractor_type>
+    nlohmann::json& load_annots_part(std::optional<nlohmann::json>& part,
+                                     const std::string& name,
+                                     extractor_type extract);
 
-    void ensure_annots_loaded();
+    nlohmann::json& get_form();
+    nlohmann::json& get_language();
 
     void update_timings(pdf_timings& timings_, bool set_timer);
 
@@ -81,7 +97,6 @@ namespace pdflib
     std::shared_ptr<std::string> buffer; // keep a shared copy, in order to not let it expire
     std::optional<std::string> password; // stored for thread-safe page decoding
 
-    std::mutex thread_safe_buffer_mutex;
     pdf_timings timings;
 
     QPDF qpdf_document;
@@ -89,11 +104,17 @@ namespace pdflib
 
     int number_of_pages;
 
-    nlohmann::json json_annots;
-    bool annots_loaded;
+    // std::nullopt until extracted (see load_annots_part)
+    std::optional<nlohmann::json> json_form;
+    std::optional<nlohmann::json> json_meta_xml;
+    std::optional<nlohmann::json> json_language;
+    std::optional<nlohmann::json> json_toc;
 
     // New: Persistent page decoders for typed API
     std::map<int, page_decoder_ptr> page_decoders;
+
+    // Decoded fonts shared by all pages of this document
+    std::shared_ptr<pdf_resource<DOCUMENT_FONTS>> document_fonts;
   };
 
   pdf_decoder<DOCUMENT>::pdf_decoder():
@@ -108,9 +129,12 @@ namespace pdflib
 
     number_of_pages(-1),
 
-    json_annots(nlohmann::json::value_t::null),
-    annots_loaded(false),
-    page_decoders({})
+    json_form(std::nullopt),
+    json_meta_xml(std::nullopt),
+    json_language(std::nullopt),
+    json_toc(std::nullopt),
+    page_decoders({}),
+    document_fonts(std::make_shared<pdf_resource<DOCUMENT_FONTS>>())
   {
     configure_qpdf_warnings(qpdf_document);
   }
@@ -127,9 +151,12 @@ namespace pdflib
 
     number_of_pages(-1),
 
-    json_annots(nlohmann::json::value_t::null),
-    annots_loaded(false),
-    page_decoders({})
+    json_form(std::nullopt),
+    json_meta_xml(std::nullopt),
+    json_language(std::nullopt),
+    json_toc(std::nullopt),
+    page_decoders({}),
+    document_fonts(std::make_shared<pdf_resource<DOCUMENT_FONTS>>())
   {
     configure_qpdf_warnings(qpdf_document);
   }
@@ -137,47 +164,64 @@ namespace pdflib
   pdf_decoder<DOCUMENT>::~pdf_decoder()
   {}
 
-  void pdf_decoder<DOCUMENT>::ensure_annots_loaded()
+  template<typename extractor_type>
+  nlohmann::json& pdf_decoder<DOCUMENT>::load_annots_part(std::optional<nlohmann::json>& part,
+                                                          const std::string& name,
+                                                          extractor_type extract)
   {
-    if(annots_loaded)
+    if(part.has_value())
       {
-        return;
+        return part.value();
       }
 
+    part = nlohmann::json(nlohmann::json::value_t::null);
+
+    utils::timer annots_timer;
     try
       {
         QPDFObjectHandle qpdf_root = qpdf_document.getRoot();
-	
-        utils::timer annots_timer;
-        json_annots = extract_document_annotations_in_json(qpdf_document, qpdf_root);
-
-        double annots_elapsed = annots_timer.get_time();
-        timings.add_timing(pdf_timings::KEY_EXTRACT_DOC_ANNOTATIONS, annots_elapsed);
+        part = extract(qpdf_document, qpdf_root);
       }
     catch(const std::exception& exc)
       {
-        LOG_S(WARNING) << "filename: " << filename << " can not find any `annotations` " << exc.what();
+        LOG_S(WARNING) << "filename: " << filename << " can not extract `" << name << "`: " << exc.what();
       }
 
-    annots_loaded = true;
+    timings.add_timing(pdf_timings::KEY_EXTRACT_DOC_ANNOTATIONS, annots_timer.get_time());
+
+    return part.value();
+  }
+
+  nlohmann::json& pdf_decoder<DOCUMENT>::get_form()
+  {
+    return load_annots_part(json_form, "form", extract_acroform_in_json);
+  }
+
+  nlohmann::json& pdf_decoder<DOCUMENT>::get_language()
+  {
+    return load_annots_part(json_language, "language", extract_language_in_json);
   }
 
   nlohmann::json pdf_decoder<DOCUMENT>::get_annotations()
   {
-    ensure_annots_loaded();
-    return json_annots;
+    nlohmann::json annots = nlohmann::json::object({});
+
+    annots["form"] = get_form();
+    annots["meta_xml"] = get_meta_xml();
+    annots["language"] = get_language();
+    annots["table_of_contents"] = get_table_of_contents();
+
+    return annots;
   }
 
   nlohmann::json pdf_decoder<DOCUMENT>::get_meta_xml()
   {
-    ensure_annots_loaded();
-    return json_annots["meta_xml"];
+    return load_annots_part(json_meta_xml, "meta_xml", extract_metadata_in_json);
   }
 
   nlohmann::json pdf_decoder<DOCUMENT>::get_table_of_contents()
   {
-    ensure_annots_loaded();
-    return json_annots["table_of_contents"];
+    return load_annots_part(json_toc, "table_of_contents", extract_toc_in_json);
   }
 
   bool pdf_decoder<DOCUMENT>::process_document_from_file(std::string& _filename,
@@ -271,68 +315,51 @@ namespace pdflib
         return false;
       }
     
-    ensure_annots_loaded();
-
     timings.add_timing(pdf_timings::KEY_PROCESS_DOCUMENT_FROM_BYTESIO, timer.get_time());
     
     return true;
   }
 
-  std::pair<int, std::shared_ptr<std::string> > pdf_decoder<DOCUMENT>::get_thread_safe_page_buffer(
-    int page_ind,
-    bool keep_qpdf_warnings)
+  std::shared_ptr<QPDF> pdf_decoder<DOCUMENT>::open_thread_safe_document(bool keep_qpdf_warnings)
   {
-    std::pair<int, std::shared_ptr<std::string> > result(-1, nullptr);
-
-    /*
-    if(not qpdf_document.anyWarnings())
+    if(buffer == nullptr)
       {
-	result.first = page_ind;
-	result.second = buffer;
+        throw std::logic_error("no buffer available to open a thread-safe document");
+      }
 
-	return result;
+    utils::timer timer;
+
+    // processMemoryFile does not copy the buffer, so the document keeps its
+    // own reference to it and stays valid even if this decoder is unloaded.
+    std::shared_ptr<std::string> document_buffer = buffer;
+    std::shared_ptr<QPDF> result(new QPDF(),
+                                 [document_buffer](QPDF* ptr) { delete ptr; });
+
+    configure_qpdf_warnings(*result);
+    result->setSuppressWarnings(!keep_qpdf_warnings);
+
+    std::string description = "thread-safe " + (filename.empty() ? std::string("buffer") : filename);
+
+    if(password.has_value())
+      {
+        result->processMemoryFile(description.c_str(),
+                                  document_buffer->c_str(),
+                                  document_buffer->size(),
+                                  password.value().c_str());
+      }
+    else
+      {
+        result->processMemoryFile(description.c_str(),
+                                  document_buffer->c_str(),
+                                  document_buffer->size());
       }
-    */
-    
-    // Thread-safe decoding uses standalone one-page PDF buffers.
-    // Page extraction and serialization are intentionally serialized, and
-    // the mutex is expected to remain held across QPDFWriter::write().
-    std::lock_guard<std::mutex> lock(thread_safe_buffer_mutex);
-    
-    //std::shared_ptr<std::string> result = nullptr;
 
-    QPDFObjectHandle qpdf_page = qpdf_pages.at(page_ind);
-    
-    {
-      utils::timer page_timer;
-      QPDF out_pdf;
-      out_pdf.setSuppressWarnings(!keep_qpdf_warnings);
-      out_pdf.emptyPDF();
-      
-      QPDFPageDocumentHelper out_pages(out_pdf);
-      QPDFAcroFormDocumentHelper out_afdh(out_pdf);
-      QPDFAcroFormDocumentHelper src_afdh(qpdf_document);
-      QPDFPageObjectHelper page_helper(qpdf_page);
-      out_pages.addPage(page_helper, false);
-      auto out_page = out_pages.getAllPages().at(0);
-      out_afdh.fixCopiedAnnotations(
-          out_page.getObjectHandle(), page_helper.getObjectHandle(), src_afdh);
-      
-      QPDFWriter writer(out_pdf);
-      writer.setOutputMemory();
-      writer.setObjectStreamMode(qpdf_o_preserve);
-      writer.setStreamDataMode(qpdf_s_preserve);
-      writer.setPreserveEncryption(true);
-      writer.write();
-      
-      auto out = writer.getBufferSharedPointer();
-
-      result.first = 0;
-      result.second = std::make_shared<std::string>(reinterpret_cast<char const*>(out->getBuffer()),
-					     out->getSize());
-      
-      LOG_S(INFO) << "writing a pdf-page buffer in " << page_timer.get_time() << " [sec]";
-    }
+    // Inherited page attributes (/Resources, /MediaBox, /CropBox, /Rotate)
+    // are pushed onto the page objects, which matches what a page looks
+    // like once it has been copied into a standalone one-page PDF.
+    result->pushInheritedAttributesToPage();
+
+    LOG_S(INFO) << "opened thread-safe qpdf document in " << timer.get_time() << " [sec]";
 
     return result;
   }
@@ -341,19 +368,18 @@ namespace pdflib
   pdf_decoder<DOCUMENT>::make_thread_safe_page_decoder(int page_number,
                                                        bool keep_qpdf_warnings)
   {
-    std::pair<int, std::shared_ptr<std::string> > result =
-      get_thread_safe_page_buffer(page_number, keep_qpdf_warnings);
+    return make_thread_safe_page_decoder(page_number,
+                                         open_thread_safe_document(keep_qpdf_warnings));
+  }
 
-    int orig_page_number = page_number;
-    int curr_page_number = result.first;
+  pdf_decoder<DOCUMENT>::page_decoder_ptr
+  pdf_decoder<DOCUMENT>::make_thread_safe_page_decoder(int page_number,
+                                                       std::shared_ptr<QPDF> thread_qpdf_document)
+  {
+    auto page_decoder = std::make_shared<pdf_decoder<PAGE>>(thread_qpdf_document, page_number);
+    page_decoder->set_font_cache(document_fonts);
 
-    std::shared_ptr<std::string> page_buffer = result.second;
-    
-    return std::make_shared<pdf_decoder<PAGE>>(page_buffer,
-                                               password,
-                                               orig_page_number,
-                                               curr_page_number,
-                                               keep_qpdf_warnings);
+    return page_decoder;
   }
   
   void pdf_decoder<DOCUMENT>::decode_document(const decode_config& config)
@@ -395,6 +421,25 @@ namespace pdflib
     timings.merge(timings_);
   }
 
+  double pdf_decoder<DOCUMENT>::estimate_page_cost(int page_number)
+  {
+    if(page_number < 0 or page_number >= static_cast<int>(qpdf_pages.size()))
+      {
+        return 0.0;
+      }
+
+    try
+      {
+        return page_cost::estimate(qpdf_pages.at(page_number));
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(WARNING) << "could not estimate the cost of page " << page_number << ": " << exc.what();
+      }
+
+    return 0.0;
+  }
+
   bool pdf_decoder<DOCUMENT>::has_page_decoder(int page_number)
   {
     return page_decoders.count(page_number) > 0;
@@ -447,6 +492,7 @@ namespace pdflib
           QPDFObjectHandle qpdf_page = qpdf_pages.at(page_number);
 
           page_decoder = std::make_shared<pdf_decoder<PAGE>>(qpdf_page, page_number);
+          page_decoder->set_font_cache(document_fonts);
         }
 
       page_decoder->decode_page(config);
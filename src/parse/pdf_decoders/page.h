@@ -16,6 +16,24 @@
 namespace pdflib
 {
 
+  // Immutable spatial index over the content of a decoded page. It is built
+  // on the first spatial query (see pdf_decoder<PAGE>::get_spatial_index) and
+  // dropped when the content changes. The ids are the indices in the
+  // page-cells (chars), word-cells, line-cells, shape-instructions and
+  // page-images.
+  struct page_spatial_index
+  {
+    utils::spatial::box_index chars;         // all page-cells
+    utils::spatial::box_index visible_chars; // page-cells that are rendered
+    utils::spatial::box_index words;
+    utils::spatial::box_index lines;
+
+    utils::spatial::box_index shapes;        // visible (clipped) bbox of visible shapes
+    utils::spatial::box_index stroked_paths; // path bbox of shapes with visible strokes
+
+    utils::spatial::box_index images;        // visible images
+  };
+
   template<>
   class pdf_decoder<PAGE>
   {
@@ -23,12 +41,10 @@ namespace pdflib
 
     pdf_decoder(QPDFObjectHandle page, int page_num);
 
-    // Thread-safe constructor: creates its own QPDF document from the shared buffer
-    pdf_decoder(std::shared_ptr<std::string> buffer,
-                std::optional<std::string> password,
-                int orig_page_num, // original page-number of the pdf
-		int curr_page_num, // page number in the buffer. The buffer might only be a single pdf page
-                bool keep_qpdf_warnings = false);
+    // Thread-safe constructor: reads the page from a QPDF document that is
+    // private to the calling thread (see pdf_decoder<DOCUMENT>::open_thread_safe_document)
+    pdf_decoder(std::shared_ptr<QPDF> qpdf_document,
+                int page_num);
 
     ~pdf_decoder();
 
@@ -36,6 +52,9 @@ namespace pdflib
 
     bool is_thread_safe() const { return thread_safe; }
 
+    // Decoded fonts are shared through (and added to) this document-wide cache
+    void set_font_cache(std::shared_ptr<pdf_resource<DOCUMENT_FONTS>> font_cache) { document_fonts = font_cache; }
+
     // Typed accessors for direct pybind11 binding
     page_item<PAGE_CELLS>& get_page_cells() { return page_cells; }
     page_item<PAGE_SHAPES>& get_page_shapes() { return page_shapes; }
@@ -54,13 +73,35 @@ namespace pdflib
     bool has_word_cells() const { return word_cells_created; }
     bool has_line_cells() const { return line_cells_created; }
 
+    // Spatial queries on [left, bottom, right, top] bboxes. They are answered
+    // from the page_spatial_index and can run concurrently.
     bool intersects_with(std::array<double, 4> bbox,
                          bool chars = false,
                          bool shapes = true,
                          bool bitmaps = true);
+    std::vector<bool> intersects_with_bboxes(const std::vector<std::array<double, 4>>& bboxes,
+                                             bool chars = false,
+                                             bool shapes = true,
+                                             bool bitmaps = true);
+
+    // indices of the cells ("char", "word" or "line") that intersect (or,
+    // with `contained`, lie within) the bbox. The char indices refer to the
+    // page-cells, which are the char-cells if those are kept.
+    std::vector<int> get_cells_in_bbox(std::array<double, 4> bbox,
+                                       const std::string& cell_unit = "word",
+                                       bool contained = false);
+    std::vector<std::vector<int>> get_cells_in_bboxes(const std::vector<std::array<double, 4>>& bboxes,
+                                                      const std::string& cell_unit = "word",
+                                                      bool contained = false);
+
     std::vector<std::array<double, 4>> get_shape_lines(bool horizontal = true,
                                                        bool vertical = true,
                                                        double tolerance = 1e-3);
+    // the shape lines that intersect the bbox
+    std::vector<std::array<double, 4>> get_shape_lines_in_bbox(std::array<double, 4> bbox,
+                                                               bool horizontal = true,
+                                                               bool vertical = true,
+                                                               double tolerance = 1e-3);
     std::vector<std::array<double, 4>>
     get_connected_shape_bounding_boxes(double tolerance = 0.0);
 
@@ -73,6 +114,13 @@ namespace pdflib
 
     void decode_page(const decode_config& config);
 
+    // Approximate heap held by the decoded content: the cells (with their
+    // text), the image stream buffers, the shapes and the render
+    // instructions (with the decoded bitmap pixels). Buffers shared between
+    // images are counted once. Used to budget in-flight results (threaded
+    // parser).
+    size_t estimate_memory_bytes();
+
     // Get timing information for this page
     pdf_timings& get_timings() { return timings; }
     const pdf_timings& get_timings() const { return timings; }
@@ -130,13 +178,19 @@ namespace pdflib
 
     void sanitise_contents(std::string page_boundary);
 
+    // build the spatial index on first use
+    std::shared_ptr<const page_spatial_index> get_spatial_index();
+    std::shared_ptr<const page_spatial_index> build_spatial_index();
+
+    void reset_spatial_index();
+
   private:
 
     bool thread_safe;
 
-    // Owned QPDF document (only used in thread-safe mode)
-    std::shared_ptr<std::string> owned_buffer;
-    std::unique_ptr<QPDF> owned_qpdf_document;
+    // QPDF document shared by all pages decoded on the same thread (only
+    // used in thread-safe mode)
+    std::shared_ptr<QPDF> owned_qpdf_document;
 
     QPDFObjectHandle qpdf_page;
 
@@ -167,6 +221,8 @@ namespace pdflib
     page_item<PAGE_SHAPES> shapes;
     page_item<PAGE_IMAGES> images;
 
+    bool cells_sanitised = false;
+
     // Computed cell aggregations
     page_item<PAGE_CELLS> word_cells;
     page_item<PAGE_CELLS> line_cells;
@@ -176,6 +232,8 @@ namespace pdflib
     std::shared_ptr<pdf_resource<PAGE_GRPHS> > page_grphs;
     std::shared_ptr<pdf_resource<PAGE_FONTS> > page_fonts;
     std::shared_ptr<pdf_resource<PAGE_COLORSPACES> > page_colorspaces;
+
+    std::shared_ptr<pdf_resource<DOCUMENT_FONTS> > document_fonts;
     std::shared_ptr<pdf_resource<PAGE_XOBJECTS> > page_xobjects;
 
     decode_config page_config;  // saved at the start of decode_page for use in widget handlers
@@ -187,11 +245,13 @@ namespace pdflib
     pdf_render_instructions instructions;
 
     pdf_timings timings;
+
+    std::mutex                                spatial_index_mutex;
+    std::shared_ptr<const page_spatial_index> spatial_index;
   };
 
   pdf_decoder<PAGE>::pdf_decoder(QPDFObjectHandle page, int page_num):
     thread_safe(false),
-    owned_buffer(nullptr),
     owned_qpdf_document(nullptr),
     qpdf_page(page),
     orig_page_number(page_num),
@@ -202,46 +262,30 @@ namespace pdflib
     page_xobjects(std::make_shared<pdf_resource<PAGE_XOBJECTS>>())
   {}
 
-  pdf_decoder<PAGE>::pdf_decoder(std::shared_ptr<std::string> buffer,
-                                 std::optional<std::string> password,
-                                 int orig_page_num,
-				 int curr_page_num,
-                                 bool keep_qpdf_warnings):
+  pdf_decoder<PAGE>::pdf_decoder(std::shared_ptr<QPDF> qpdf_document,
+                                 int page_num):
     thread_safe(true),
-    owned_buffer(buffer),
-    owned_qpdf_document(std::make_unique<QPDF>()),
+    owned_qpdf_document(qpdf_document),
     qpdf_page(),
-    orig_page_number(orig_page_num),
-    curr_page_number(curr_page_num),
+    orig_page_number(page_num),
+    curr_page_number(page_num),
     page_grphs(std::make_shared<pdf_resource<PAGE_GRPHS>>()),
     page_fonts(std::make_shared<pdf_resource<PAGE_FONTS>>()),
     page_colorspaces(std::make_shared<pdf_resource<PAGE_COLORSPACES>>()),
     page_xobjects(std::make_shared<pdf_resource<PAGE_XOBJECTS>>())
   {
-    std::string description = "thread-safe page " + std::to_string(orig_page_num);
-
-    configure_qpdf_warnings(*owned_qpdf_document);
-    owned_qpdf_document->setSuppressWarnings(!keep_qpdf_warnings);
-
-    if(password.has_value())
+    if(owned_qpdf_document == nullptr)
       {
-        owned_qpdf_document->processMemoryFile(description.c_str(),
-                                               owned_buffer->c_str(),
-                                               owned_buffer->size(),
-                                               password.value().c_str());
-      }
-    else
-      {
-        owned_qpdf_document->processMemoryFile(description.c_str(),
-                                               owned_buffer->c_str(),
-                                               owned_buffer->size());
+        throw std::invalid_argument("thread-safe page decoder requires a QPDF document");
       }
 
-    std::vector<QPDFObjectHandle> pages = owned_qpdf_document->getAllPages();
+    // getAllPages caches the page list inside the QPDF object, so only
+    // the first page decoded on a given document pays for the traversal.
+    std::vector<QPDFObjectHandle> const& pages = owned_qpdf_document->getAllPages();
 
     if(curr_page_number < 0 || curr_page_number >= static_cast<int>(pages.size()))
       {
-        LOG_S(ERROR) << "page " << curr_page_num << " is out of bounds (0-" << pages.size()-1 << ")";
+        LOG_S(ERROR) << "page " << page_num << " is out of bounds (0-" << pages.size()-1 << ")";
         throw std::out_of_range("page number out of bounds: " + std::to_string(curr_page_number));
       }
 
@@ -336,14 +380,6 @@ namespace pdflib
       return paints_stroke and instr.get_stroke_alpha() > 0.0;
     }
 
-    inline bool bbox_overlaps_with_tolerance(const std::array<double, 4>& a,
-                                             const std::array<double, 4>& b,
-                                             double tolerance)
-    {
-      return a[0] <= b[2] + tolerance and a[2] + tolerance >= b[0] and
-             a[1] <= b[3] + tolerance and a[3] + tolerance >= b[1];
-    }
-
     inline bool shape_visible_bbox(const shape_instruction& instr,
                                    std::array<double, 4>& bbox)
     {
@@ -455,100 +491,388 @@ namespace pdflib
 
       return applied_clip;
     }
+
+    inline std::array<double, 4> cell_bbox(page_item<PAGE_CELL>& cell)
+    {
+      return {
+        std::min({cell.r_x0, cell.r_x1, cell.r_x2, cell.r_x3}),
+        std::min({cell.r_y0, cell.r_y1, cell.r_y2, cell.r_y3}),
+        std::max({cell.r_x0, cell.r_x1, cell.r_x2, cell.r_x3}),
+        std::max({cell.r_y0, cell.r_y1, cell.r_y2, cell.r_y3})
+      };
+    }
+
+    inline std::vector<std::array<double, 4>> cell_bboxes(page_item<PAGE_CELLS>& cells)
+    {
+      std::vector<std::array<double, 4>> result;
+      result.reserve(cells.size());
+
+      for(auto& cell : cells)
+        {
+          result.push_back(cell_bbox(cell));
+        }
+
+      return result;
+    }
+
+    inline bool bbox_contains(std::array<double, 4> outer,
+                              std::array<double, 4> inner)
+    {
+      if(outer[0] > outer[2]) { std::swap(outer[0], outer[2]); }
+      if(outer[1] > outer[3]) { std::swap(outer[1], outer[3]); }
+      if(inner[0] > inner[2]) { std::swap(inner[0], inner[2]); }
+      if(inner[1] > inner[3]) { std::swap(inner[1], inner[3]); }
+
+      return outer[0] <= inner[0] and inner[2] <= outer[2] and
+             outer[1] <= inner[1] and inner[3] <= outer[3];
+    }
+
+    // the raw bbox of the path points, without stroke or clipping
+    inline bool shape_path_bbox(const shape_instruction& instr,
+                                std::array<double, 4>& bbox)
+    {
+      bool have_point = false;
+      auto include_point = [&](double x, double y) {
+        if(not have_point)
+          {
+            bbox = {x, y, x, y};
+            have_point = true;
+            return;
+          }
+        bbox[0] = std::min(bbox[0], x);
+        bbox[1] = std::min(bbox[1], y);
+        bbox[2] = std::max(bbox[2], x);
+        bbox[3] = std::max(bbox[3], y);
+      };
+
+      for(const auto& subpath : instr.get_subpaths())
+        {
+          include_point(subpath.get_x0(), subpath.get_y0());
+          const auto& xs = subpath.get_px();
+          const auto& ys = subpath.get_py();
+          for(size_t i = 0; i < std::min(xs.size(), ys.size()); ++i)
+            {
+              include_point(xs[i], ys[i]);
+            }
+        }
+
+      return have_point;
+    }
+
+    inline void append_shape_lines(const shape_instruction& instr,
+                                   bool horizontal,
+                                   bool vertical,
+                                   double tol,
+                                   std::vector<std::array<double, 4>>& result)
+    {
+      for(const auto& subpath : instr.get_subpaths())
+        {
+          double curr_x = subpath.get_x0();
+          double curr_y = subpath.get_y0();
+          double last_x = curr_x;
+          double last_y = curr_y;
+
+          const auto& ops = subpath.get_ops();
+          const auto& xs = subpath.get_px();
+          const auto& ys = subpath.get_py();
+          size_t point_index = 0;
+
+          auto maybe_add_line = [&](double x0, double y0,
+                                    double x1, double y1) {
+            const bool is_horizontal = std::abs(y1 - y0) <= tol;
+            const bool is_vertical = std::abs(x1 - x0) <= tol;
+
+            if(is_horizontal and is_vertical) { return; }
+
+            if((is_horizontal and not horizontal) or
+               (is_vertical and not vertical) or
+               (not is_horizontal and not is_vertical))
+              {
+                return;
+              }
+
+            std::array<double, 4> bbox = {0.0, 0.0, 0.0, 0.0};
+            if(clip_axis_aligned_segment(x0, y0, x1, y1,
+                                         instr.get_clip_state(), tol, bbox))
+              {
+                result.push_back(bbox);
+              }
+          };
+
+          for(const auto op : ops)
+            {
+              if(op == SEGMENT_LINE_TO)
+                {
+                  if(point_index >= std::min(xs.size(), ys.size())) { break; }
+
+                  const double next_x = xs[point_index];
+                  const double next_y = ys[point_index];
+                  maybe_add_line(curr_x, curr_y, next_x, next_y);
+
+                  curr_x = next_x;
+                  curr_y = next_y;
+                  last_x = curr_x;
+                  last_y = curr_y;
+                  point_index += 1;
+                }
+              else if(op == SEGMENT_CUBIC_TO)
+                {
+                  if(point_index + 2 >= std::min(xs.size(), ys.size())) { break; }
+
+                  curr_x = xs[point_index + 2];
+                  curr_y = ys[point_index + 2];
+                  last_x = curr_x;
+                  last_y = curr_y;
+                  point_index += 3;
+                }
+            }
+
+          if(subpath.get_closing_type() == CLOSED)
+            {
+              maybe_add_line(last_x, last_y, subpath.get_x0(), subpath.get_y0());
+            }
+        }
+    }
   }
 
-  bool pdf_decoder<PAGE>::intersects_with(std::array<double, 4> bbox,
-                                          bool chars,
-                                          bool shapes,
-                                          bool bitmaps)
+  std::shared_ptr<const page_spatial_index> pdf_decoder<PAGE>::get_spatial_index()
   {
-    if(bbox[0] > bbox[2]) { std::swap(bbox[0], bbox[2]); }
-    if(bbox[1] > bbox[3]) { std::swap(bbox[1], bbox[3]); }
+    std::lock_guard<std::mutex> lock(spatial_index_mutex);
+
+    if(spatial_index == nullptr)
+      {
+        spatial_index = build_spatial_index();
+      }
+
+    return spatial_index;
+  }
+
+  std::shared_ptr<const page_spatial_index> pdf_decoder<PAGE>::build_spatial_index()
+  {
+    LOG_S(INFO) << __FUNCTION__;
+
+    auto index = std::make_shared<page_spatial_index>();
+
+    {
+      std::vector<std::array<double, 4>> boxes = cell_bboxes(page_cells);
+
+      std::vector<bool> visible(page_cells.size(), false);
+      for(size_t i = 0; i < page_cells.size(); ++i)
+        {
+          auto& cell = page_cells[i];
+          visible[i] = (cell.active and (not cell.text.empty()) and
+                        cell.rendering_mode != 3 and cell.rendering_mode != 7);
+        }
+
+      index->chars.build(boxes);
+      index->visible_chars.build(boxes, 0.0, visible);
+    }
+
+    index->words.build(cell_bboxes(word_cells));
+    index->lines.build(cell_bboxes(line_cells));
+
+    {
+      const auto& shape_instrs = instructions.get_shape_instructions();
+
+      std::vector<std::array<double, 4>> visible_boxes(shape_instrs.size(), {0.0, 0.0, 0.0, 0.0});
+      std::vector<std::array<double, 4>> path_boxes(shape_instrs.size(), {0.0, 0.0, 0.0, 0.0});
+
+      std::vector<bool> visible(shape_instrs.size(), false);
+      std::vector<bool> stroked(shape_instrs.size(), false);
+
+      for(size_t i = 0; i < shape_instrs.size(); ++i)
+        {
+          visible[i] = shape_visible_bbox(shape_instrs[i], visible_boxes[i]);
+
+          stroked[i] = (shape_instruction_strokes_visible(shape_instrs[i]) and
+                        shape_path_bbox(shape_instrs[i], path_boxes[i]));
+        }
+
+      index->shapes.build(visible_boxes, 0.0, visible);
+      index->stroked_paths.build(path_boxes, 0.0, stroked);
+    }
+
+    {
+      std::vector<std::array<double, 4>> boxes;
+      std::vector<bool> visible;
+
+      for(auto& image : page_images)
+        {
+          boxes.push_back(image.has_visible_bbox
+                          ? std::array<double, 4>{image.visible_x0, image.visible_y0,
+                                                  image.visible_x1, image.visible_y1}
+                          : std::array<double, 4>{image.x0, image.y0, image.x1, image.y1});
+          visible.push_back(image.is_visible);
+        }
+
+      index->images.build(boxes, 0.0, visible);
+    }
+
+    return index;
+  }
+
+  void pdf_decoder<PAGE>::reset_spatial_index()
+  {
+    std::lock_guard<std::mutex> lock(spatial_index_mutex);
+    spatial_index = nullptr;
+  }
+
+  size_t pdf_decoder<PAGE>::estimate_memory_bytes()
+  {
+    size_t result = 0;
 
-    if(chars)
+    for(auto* item : {&page_cells, &char_cells, &word_cells, &line_cells, &cells})
       {
-        for(auto& cell : page_cells)
+        result += item->capacity()*sizeof(page_item<PAGE_CELL>);
+
+        for(auto& cell : *item)
           {
-            if(not cell.active or cell.text.empty()) { continue; }
-            if(cell.rendering_mode == 3 or cell.rendering_mode == 7) { continue; }
-
-            std::array<double, 4> cell_bbox = {
-              std::min({cell.r_x0, cell.r_x1, cell.r_x2, cell.r_x3}),
-              std::min({cell.r_y0, cell.r_y1, cell.r_y2, cell.r_y3}),
-              std::max({cell.r_x0, cell.r_x1, cell.r_x2, cell.r_x3}),
-              std::max({cell.r_y0, cell.r_y1, cell.r_y2, cell.r_y3})
-            };
-            if(bbox_intersects(bbox, cell_bbox)) { return true; }
+            result += cell.text.capacity();
           }
       }
 
-    if(shapes)
+    std::set<const void*> counted;
+    auto count_buffer = [&](const void* ptr, size_t size)
+    {
+      if(ptr!=nullptr and counted.insert(ptr).second)
+        {
+          result += size;
+        }
+    };
+
+    for(auto* item : {&page_images, &images})
       {
-        for(const auto& instr : instructions.get_shape_instructions())
+        result += item->size()*sizeof(page_item<PAGE_IMAGE>);
+
+        for(auto& image : *item)
           {
-            if(not shape_instruction_visible(instr)) { continue; }
+            if(image.raw_stream_data)
+              {
+                count_buffer(image.raw_stream_data.get(), image.raw_stream_data->getSize());
+              }
 
-            bool have_point = false;
-            std::array<double, 4> shape_bbox = {0.0, 0.0, 0.0, 0.0};
-            auto include_point = [&](double x, double y) {
-              if(not have_point)
-                {
-                  shape_bbox = {x, y, x, y};
-                  have_point = true;
-                  return;
-                }
-              shape_bbox[0] = std::min(shape_bbox[0], x);
-              shape_bbox[1] = std::min(shape_bbox[1], y);
-              shape_bbox[2] = std::max(shape_bbox[2], x);
-              shape_bbox[3] = std::max(shape_bbox[3], y);
-            };
+            if(image.decoded_stream_data)
+              {
+                count_buffer(image.decoded_stream_data.get(), image.decoded_stream_data->getSize());
+              }
 
-            for(const auto& subpath : instr.get_subpaths())
+            if(image.soft_mask_data)
               {
-                include_point(subpath.get_x0(), subpath.get_y0());
-                const auto& xs = subpath.get_px();
-                const auto& ys = subpath.get_py();
-                for(size_t i = 0; i < std::min(xs.size(), ys.size()); ++i)
-                  {
-                    include_point(xs[i], ys[i]);
-                  }
+                count_buffer(image.soft_mask_data.get(), image.soft_mask_data->size());
               }
+          }
+      }
 
-            if(not have_point) { continue; }
-            const double stroke_pad = shape_instruction_strokes_visible(instr)
-              ? std::max(0.0, instr.get_line_width()) * 0.5
-              : 0.0;
-            shape_bbox[0] -= stroke_pad;
-            shape_bbox[1] -= stroke_pad;
-            shape_bbox[2] += stroke_pad;
-            shape_bbox[3] += stroke_pad;
+    // the decoded pixels of the bitmaps are the bulk of a scanned page
+    result += page_shapes.estimate_memory_bytes();
+    result += shapes.estimate_memory_bytes();
+    result += instructions.estimate_memory_bytes();
 
-            bool shape_visible = true;
-            const std::array<double, 4> visible_shape_bbox =
-              clipped_bbox(shape_bbox, instr.get_clip_state(), shape_visible);
+    return result;
+  }
+
+  bool pdf_decoder<PAGE>::intersects_with(std::array<double, 4> bbox,
+                                          bool chars,
+                                          bool shapes,
+                                          bool bitmaps)
+  {
+    return intersects_with_bboxes({bbox}, chars, shapes, bitmaps).at(0);
+  }
+
+  std::vector<bool>
+  pdf_decoder<PAGE>::intersects_with_bboxes(const std::vector<std::array<double, 4>>& bboxes,
+                                            bool chars,
+                                            bool shapes,
+                                            bool bitmaps)
+  {
+    std::vector<bool> result(bboxes.size(), false);
+    if(bboxes.empty() or not (chars or shapes or bitmaps)) { return result; }
+
+    std::shared_ptr<const page_spatial_index> index = get_spatial_index();
+
+    std::vector<const utils::spatial::box_index*> layers;
+    if(chars)   { layers.push_back(&(index->visible_chars)); }
+    if(shapes)  { layers.push_back(&(index->shapes)); }
+    if(bitmaps) { layers.push_back(&(index->images)); }
+
+    std::vector<uint32_t> candidates;
+    for(size_t i = 0; i < bboxes.size(); ++i)
+      {
+        std::array<double, 4> bbox = bboxes[i];
+        if(bbox[0] > bbox[2]) { std::swap(bbox[0], bbox[2]); }
+        if(bbox[1] > bbox[3]) { std::swap(bbox[1], bbox[3]); }
+
+        for(auto layer : layers)
+          {
+            // the grid returns the boxes that touch the bbox, the overlap
+            // itself has to be strict
+            layer->query(bbox, candidates);
 
-            if(shape_visible and bbox_intersects(bbox, visible_shape_bbox))
+            for(auto id : candidates)
               {
-                return true;
+                if(bbox_intersects(bbox, layer->get_bbox(id)))
+                  {
+                    result[i] = true;
+                    break;
+                  }
               }
+
+            if(result[i]) { break; }
           }
       }
 
-    if(bitmaps)
+    return result;
+  }
+
+  std::vector<int>
+  pdf_decoder<PAGE>::get_cells_in_bbox(std::array<double, 4> bbox,
+                                       const std::string& cell_unit,
+                                       bool contained)
+  {
+    return get_cells_in_bboxes({bbox}, cell_unit, contained).at(0);
+  }
+
+  std::vector<std::vector<int>>
+  pdf_decoder<PAGE>::get_cells_in_bboxes(const std::vector<std::array<double, 4>>& bboxes,
+                                         const std::string& cell_unit,
+                                         bool contained)
+  {
+    std::shared_ptr<const page_spatial_index> index = get_spatial_index();
+
+    const utils::spatial::box_index* layer = nullptr;
+    if(cell_unit == "char")      { layer = &(index->chars); }
+    else if(cell_unit == "word") { layer = &(index->words); }
+    else if(cell_unit == "line") { layer = &(index->lines); }
+    else
       {
-        for(auto& image : page_images)
+        std::string message = "unknown cell-unit: " + cell_unit + " (expected char, word or line)";
+        LOG_S(ERROR) << message;
+        throw std::logic_error(message);
+      }
+
+    std::vector<std::vector<int>> result(bboxes.size());
+
+    std::vector<uint32_t> candidates;
+    for(size_t i = 0; i < bboxes.size(); ++i)
+      {
+        std::array<double, 4> bbox = bboxes[i];
+        if(bbox[0] > bbox[2]) { std::swap(bbox[0], bbox[2]); }
+        if(bbox[1] > bbox[3]) { std::swap(bbox[1], bbox[3]); }
+
+        layer->query(bbox, candidates);
+
+        for(auto id : candidates)
           {
-            if(not image.is_visible) { continue; }
+            const std::array<double, 4>& cbox = layer->get_bbox(id);
 
-            std::array<double, 4> image_bbox = image.has_visible_bbox
-              ? std::array<double, 4>{image.visible_x0, image.visible_y0,
-                                      image.visible_x1, image.visible_y1}
-              : std::array<double, 4>{image.x0, image.y0, image.x1, image.y1};
-            if(bbox_intersects(bbox, image_bbox)) { return true; }
+            if(contained? bbox_contains(bbox, cbox) : bbox_intersects(bbox, cbox))
+              {
+                result[i].push_back(static_cast<int>(id));
+              }
           }
       }
 
-    return false;
+    return result;
   }
 
   std::vector<std::array<double, 4>>
@@ -565,71 +889,47 @@ namespace pdflib
       {
         if(not shape_instruction_strokes_visible(instr)) { continue; }
 
-        for(const auto& subpath : instr.get_subpaths())
-          {
-            double curr_x = subpath.get_x0();
-            double curr_y = subpath.get_y0();
-            double last_x = curr_x;
-            double last_y = curr_y;
-
-            const auto& ops = subpath.get_ops();
-            const auto& xs = subpath.get_px();
-            const auto& ys = subpath.get_py();
-            size_t point_index = 0;
-
-            auto maybe_add_line = [&](double x0, double y0,
-                                      double x1, double y1) {
-              const bool is_horizontal = std::abs(y1 - y0) <= tol;
-              const bool is_vertical = std::abs(x1 - x0) <= tol;
-
-              if(is_horizontal and is_vertical) { return; }
-
-              if((is_horizontal and not horizontal) or
-                 (is_vertical and not vertical) or
-                 (not is_horizontal and not is_vertical))
-                {
-                  return;
-                }
+        append_shape_lines(instr, horizontal, vertical, tol, result);
+      }
 
-              std::array<double, 4> bbox = {0.0, 0.0, 0.0, 0.0};
-              if(clip_axis_aligned_segment(x0, y0, x1, y1,
-                                           instr.get_clip_state(), tol, bbox))
-                {
-                  result.push_back(bbox);
-                }
-            };
+    return result;
+  }
 
-            for(const auto op : ops)
-              {
-                if(op == SEGMENT_LINE_TO)
-                  {
-                    if(point_index >= std::min(xs.size(), ys.size())) { break; }
+  std::vector<std::array<double, 4>>
+  pdf_decoder<PAGE>::get_shape_lines_in_bbox(std::array<double, 4> bbox,
+                                             bool horizontal,
+                                             bool vertical,
+                                             double tolerance)
+  {
+    std::vector<std::array<double, 4>> result;
+    if(not horizontal and not vertical) { return result; }
 
-                    const double next_x = xs[point_index];
-                    const double next_y = ys[point_index];
-                    maybe_add_line(curr_x, curr_y, next_x, next_y);
+    const double tol = std::max(0.0, tolerance);
 
-                    curr_x = next_x;
-                    curr_y = next_y;
-                    last_x = curr_x;
-                    last_y = curr_y;
-                    point_index += 1;
-                  }
-                else if(op == SEGMENT_CUBIC_TO)
-                  {
-                    if(point_index + 2 >= std::min(xs.size(), ys.size())) { break; }
+    if(bbox[0] > bbox[2]) { std::swap(bbox[0], bbox[2]); }
+    if(bbox[1] > bbox[3]) { std::swap(bbox[1], bbox[3]); }
 
-                    curr_x = xs[point_index + 2];
-                    curr_y = ys[point_index + 2];
-                    last_x = curr_x;
-                    last_y = curr_y;
-                    point_index += 3;
-                  }
-              }
+    std::shared_ptr<const page_spatial_index> index = get_spatial_index();
+
+    // the lines of a path lie within the bbox of its points
+    std::vector<uint32_t> candidates;
+    index->stroked_paths.query({bbox[0]-tol, bbox[1]-tol, bbox[2]+tol, bbox[3]+tol}, candidates);
+
+    const auto& shape_instrs = instructions.get_shape_instructions();
+
+    std::vector<std::array<double, 4>> lines;
+    for(auto id : candidates)
+      {
+        lines.clear();
+        append_shape_lines(shape_instrs.at(id), horizontal, vertical, tol, lines);
 
-            if(subpath.get_closing_type() == CLOSED)
+        // lines are degenerate boxes, so touching the bbox counts
+        for(const auto& line : lines)
+          {
+            if(line[0] <= bbox[2] and bbox[0] <= line[2] and
+               line[1] <= bbox[3] and bbox[1] <= line[3])
               {
-                maybe_add_line(last_x, last_y, subpath.get_x0(), subpath.get_y0());
+                result.push_back(line);
               }
           }
       }
@@ -652,42 +952,7 @@ namespace pdflib
           }
       }
 
-    std::vector<bool> consumed(boxes.size(), false);
-    std::vector<std::array<double, 4>> result;
-
-    for(size_t i = 0; i < boxes.size(); ++i)
-      {
-        if(consumed[i]) { continue; }
-
-        consumed[i] = true;
-        std::array<double, 4> component = boxes[i];
-
-        bool changed = true;
-        while(changed)
-          {
-            changed = false;
-            for(size_t j = 0; j < boxes.size(); ++j)
-              {
-                if(consumed[j]) { continue; }
-
-                if(bbox_overlaps_with_tolerance(component, boxes[j], tol))
-                  {
-                    component = {
-                      std::min(component[0], boxes[j][0]),
-                      std::min(component[1], boxes[j][1]),
-                      std::max(component[2], boxes[j][2]),
-                      std::max(component[3], boxes[j][3])
-                    };
-                    consumed[j] = true;
-                    changed = true;
-                  }
-              }
-          }
-
-        result.push_back(component);
-      }
-
-    return result;
+    return utils::spatial::connected_bounding_boxes(boxes, tol);
   }
 
   void pdf_decoder<PAGE>::save_pdf_page(std::filesystem::path const& out_path) const
@@ -804,6 +1069,10 @@ namespace pdflib
   {
     page_config = config;
 
+    reset_spatial_index();
+
+    page_fonts->set_font_cache(document_fonts, config.extract_font_programs);
+
     if(owned_qpdf_document != nullptr)
       {
         owned_qpdf_document->setSuppressWarnings(!config.keep_qpdf_warnings);
@@ -894,6 +1163,7 @@ namespace pdflib
     else
       {
         LOG_S(WARNING) << "skipping sanitization!";
+        cells_sanitised = false;
       }
 
     if(config.keep_char_cells)
@@ -1090,6 +1360,15 @@ namespace pdflib
         {
           utils::timer content_decode_timer;
           stream_decoder.decode(content);
+
+          // size the cells from a pre-scan of the text in the stream; with
+          // many streams, keep the growth geometric instead of exact
+          size_t needed = page_cells.size()+stream_decoder.estimate_cells();
+          if(needed > page_cells.capacity())
+            {
+              page_cells.reserve(std::max(needed, 2*page_cells.capacity()));
+            }
+
           timings.add_timing(pdf_timings::KEY_CONTENT_DECODE_TOTAL, content_decode_timer.get_time());
         }
         //stream_decoder.print();
@@ -1321,12 +1600,10 @@ namespace pdflib
       //cell.chars  = {};//chars;
       //cell.widths = {};//widths;
 
-      cell.enc_name = "Form-font"; //font.get_encoding_name();
-
-      cell.font_enc = "Form-font"; //to_string(font.get_encoding());
-      cell.font_key = "Form-font"; //font.get_key();
-
-      cell.font_name = "Form-font"; //font.get_name();
+      cell.set_font("Form-font",  // font.get_encoding_name();
+                    "Form-font",  // to_string(font.get_encoding());
+                    "Form-font",  // font.get_key();
+                    "Form-font"); // font.get_name();
       cell.font_size = 0; //font_size/1000.0;
 
       cell.italic = false;
@@ -1799,20 +2076,8 @@ namespace pdflib
       //sanitator.remove_duplicate_chars(page_cells, 0.5);
       //sanitator.sanitize_text(page_cells);
 
-      cells = page_cells;
-
-      double horizontal_cell_tolerance=1.0;
-      bool enforce_same_font=true;
-      //double space_width_factor_for_merge=1.5;
-      double space_width_factor_for_merge=1.0;
-      double space_width_factor_for_merge_with_space=0.33;
-
-      sanitator.sanitize_bbox(cells,
-                              horizontal_cell_tolerance,
-                              enforce_same_font,
-                              space_width_factor_for_merge,
-                              space_width_factor_for_merge_with_space,
-                              false);
+      cells = sanitator.create_sanitised_cells(page_cells);
+      cells_sanitised = true;
 
       //sanitator.sanitize_text(cells);
 
@@ -1830,10 +2095,11 @@ namespace pdflib
 
     word_cells = sanitizer.create_word_cells(page_cells, config);
 
-    // Remove duplicates (quadratic but necessary)
+    // Remove duplicates (grid-indexed, see remove_duplicate_cells)
     sanitizer.remove_duplicate_cells(word_cells, 0.5, true);
 
     word_cells_created = true;
+    reset_spatial_index();
 
     LOG_S(INFO) << "#-page-cells: " << page_cells.size() << " -> #-word-cells: " << word_cells.size();
     timings.add_timing(pdf_timings::KEY_CREATE_WORD_CELLS, timer.get_time());
@@ -1846,12 +2112,23 @@ namespace pdflib
 
     page_item_sanitator<PAGE_CELLS> sanitizer;
 
-    line_cells = sanitizer.create_line_cells(page_cells, config);
+    // with the default config, the line-cells are contracted exactly like
+    // the sanitised cells, so the latter are reused
+    if(cells_sanitised and sanitizer.has_sanitised_merge_rules(config))
+      {
+        LOG_S(INFO) << "copying line-cells from the sanitised cells";
+        line_cells = cells;
+      }
+    else
+      {
+        line_cells = sanitizer.create_line_cells(page_cells, config);
+      }
 
-    // Remove duplicates (quadratic but necessary)
+    // Remove duplicates (grid-indexed, see remove_duplicate_cells)
     sanitizer.remove_duplicate_cells(line_cells, 0.5, true);
 
     line_cells_created = true;
+    reset_spatial_index();
 
     LOG_S(INFO) << "#-page-cells: " << page_cells.size() << " -> #-line-cells: " << line_cells.size();
     timings.add_timing(pdf_timings::KEY_CREATE_LINE_CELLS, timer.get_time());
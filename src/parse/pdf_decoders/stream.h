@@ -34,8 +34,15 @@ namespace pdflib
 
     std::unordered_set<std::string> get_unknown_operators();
 
-    // decode the qpdf-stream
-    void decode(QPDFObjectHandle& content);
+    // decode the qpdf-stream. With the native lexer, the stream is only
+    // decompressed here and tokenized in chunks while it is interpreted;
+    // the time of the latter is booked on `timing_key`.
+    void decode(QPDFObjectHandle& content,
+                const std::string& timing_key=pdf_timings::KEY_CONTENT_DECODE_TOTAL);
+
+    // upper bound on the number of cells the decoded stream will add (0 if
+    // it is unknown), see pdf_stream_lexer::estimate_text_bytes
+    size_t estimate_cells();
 
     // methods used to interprete the stream
     void interprete(std::vector<qpdf_stream_instruction>& parameters);
@@ -51,6 +58,8 @@ namespace pdflib
 
     void interprete_stream(std::vector<qpdf_stream_instruction>& parameters);
 
+    void interprete_instructions(std::vector<qpdf_stream_instruction>& parameters);
+
     pdf_state<GLOBAL>&  current_global_state(); // get current global state
     pdf_state<TEXT>&    current_text_state(); // get current text state
     pdf_state<SHAPE>&   current_shape_state(); // get current shape state
@@ -60,7 +69,7 @@ namespace pdflib
     void q();
     void Q();
     
-    void execute_operator(qpdf_stream_instruction op,
+    void execute_operator(qpdf_stream_instruction& op,
                           std::vector<qpdf_stream_instruction>& parameters);
     
     void do_image(const std::string& xobj_name,
@@ -95,6 +104,16 @@ namespace pdflib
     std::vector<qpdf_stream_instruction> stream;
     std::vector<pdf_state<GLOBAL> > stack;
 
+    // number of tokens that are lexed at once with the native lexer
+    static const size_t LEXER_CHUNK_SIZE = 4096;
+
+    // cap on the up-front reservation of page-cells per content-stream
+    static const size_t MAX_ESTIMATED_CELLS = 65536;
+
+    bool             use_lexer;
+    pdf_stream_lexer lexer;
+    std::string      lexer_timing_key;
+
     int stack_count;
   };
 
@@ -135,6 +154,10 @@ namespace pdflib
     stream({}),
     stack({}),
 
+    use_lexer(false),
+    lexer(),
+    lexer_timing_key(pdf_timings::KEY_CONTENT_DECODE_TOTAL),
+
     stack_count(0)
   {
     LOG_S(INFO) << __FUNCTION__;
@@ -164,16 +187,41 @@ namespace pdflib
     LOG_S(INFO) << __FUNCTION__;
     for(auto row:stream)
       {
-        LOG_S(INFO) << std::setw(12) << row.key << " | " << row.val;
+        LOG_S(INFO) << std::setw(12) << row.key() << " | " << row.val();
       }
   }
 
-  void pdf_decoder<STREAM>::decode(QPDFObjectHandle& qpdf_content)
+  void pdf_decoder<STREAM>::decode(QPDFObjectHandle& qpdf_content,
+                                   const std::string& timing_key)
   {
     LOG_S(INFO) << __FUNCTION__;
 
-    qpdf_stream_decoder decoder(stream);
-    decoder.decode(qpdf_content);
+    stream.clear();
+
+    use_lexer        = false;
+    lexer_timing_key = timing_key;
+
+    if(config.native_content_lexer)
+      {
+        // falls back on QPDF if the stream data can not be decoded
+        use_lexer = lexer.set(qpdf_content);
+      }
+
+    if(not use_lexer)
+      {
+        qpdf_stream_decoder decoder(stream);
+        decoder.decode(qpdf_content);
+      }
+  }
+
+  size_t pdf_decoder<STREAM>::estimate_cells()
+  {
+    if(not use_lexer)
+      {
+        return 0;
+      }
+
+    return lexer.estimate_text_bytes(MAX_ESTIMATED_CELLS);
   }
 
   void pdf_decoder<STREAM>::interprete(std::vector<qpdf_stream_instruction>& parameters)
@@ -246,26 +294,52 @@ namespace pdflib
   {
     LOG_S(INFO) << __FUNCTION__;
 
+    if(not use_lexer)
+      {
+        interprete_instructions(parameters);
+        return;
+      }
+
+    // the parameters of an operator can be split over two chunks, they
+    // are carried over in `parameters`
+    while(not lexer.done())
+      {
+        utils::timer lexer_timer;
+        lexer.next(stream, LEXER_CHUNK_SIZE);
+
+        double lexer_seconds = lexer_timer.get_time();
+        timings.add_timing(lexer_timing_key, lexer_seconds);
+        timings.note_attributed(lexer_seconds);
+
+        interprete_instructions(parameters);
+      }
+
+    stream.clear();
+    use_lexer = false;
+  }
+
+  void pdf_decoder<STREAM>::interprete_instructions(std::vector<qpdf_stream_instruction>& parameters)
+  {
     for(int l=0; l<stream.size(); l++)
       {
         qpdf_stream_instruction& inst = stream[l];
 
-        if(inst.key=="operator")
+        if(inst.type==TOKEN_OPERATOR)
           {
             for(auto itr=parameters.begin(); itr!=parameters.end(); )
               {
-                if(itr->key=="null" and itr->val=="null") // this can happen if you have an empty array/dict
+                if(itr->type==TOKEN_NULL) // this can happen if you have an empty array/dict
                   {
-                    LOG_S(ERROR) << "\t" << std::setw(12) << itr->key << " | " << itr->val << " => erasing ...";
+                    LOG_S(ERROR) << "\t" << std::setw(12) << itr->key() << " | " << itr->val() << " => erasing ...";
                     itr = parameters.erase(itr);
                   }
                 else
                   {
-                    LOG_S(INFO) << "\t" << std::setw(12) << itr->key << " | " << itr->val;
+                    LOG_S(INFO) << "\t" << std::setw(12) << itr->key() << " | " << itr->val();
                     itr++;
                   }
               }
-            LOG_S(INFO) << " --> " << std::setw(12) << inst.key << " | " << inst.val;
+            LOG_S(INFO) << " --> " << std::setw(12) << inst.key() << " | " << inst.val();
 
             execute_operator(inst, parameters);
 
@@ -444,12 +518,6 @@ namespace pdflib
       current_global_state().cm(xobj.get_matrix());
 
       {
-        utils::timer parse_stream_timer;
-        std::vector<qpdf_stream_instruction> insts = xobj.parse_stream();
-        parse_stream_seconds = parse_stream_timer.get_time();
-        timings.add_timing(pdf_timings::KEY_PARSE_STREAM_TOTAL, parse_stream_seconds);
-        timings.note_attributed(parse_stream_seconds);
-
         pdf_decoder<STREAM> new_stream(config,
 
                                        page_dimension,
@@ -466,13 +534,45 @@ namespace pdflib
 
                                        timings);
 
+        // With the native lexer, the stream is tokenized while it is
+        // interpreted (that part is booked on parse_stream_total by
+        // new_stream itself).
+        std::vector<qpdf_stream_instruction> insts;
+        {
+          utils::timer parse_stream_timer;
+          if(config.native_content_lexer)
+            {
+              QPDFObjectHandle xobj_stream = xobj.get_stream();
+              new_stream.decode(xobj_stream, pdf_timings::KEY_PARSE_STREAM_TOTAL);
+            }
+          else
+            {
+              insts = xobj.parse_stream();
+            }
+          parse_stream_seconds = parse_stream_timer.get_time();
+          timings.add_timing(pdf_timings::KEY_PARSE_STREAM_TOTAL, parse_stream_seconds);
+          timings.note_attributed(parse_stream_seconds);
+        }
+
         bool updated_stack = new_stream.update_stack(stack, stack_count);
 
         // copy the stack
         std::vector<qpdf_stream_instruction> parameters;
         {
           utils::timer interprete_timer;
-          new_stream.interprete(insts, parameters);
+          if(config.native_content_lexer)
+            {
+              new_stream.interprete(parameters);
+
+              if(parameters.size()!=0)
+                {
+                  LOG_S(ERROR) << "Finishing a `Do` with nonzero number of parameters!";
+                }
+            }
+          else
+            {
+              new_stream.interprete(insts, parameters);
+            }
           interprete_seconds = interprete_timer.get_time();
         }
 
@@ -508,10 +608,11 @@ namespace pdflib
     LOG_S(WARNING) << "unsupported xobject subtype (PostScript) with name " << xobj_name;
   }
 
-  void pdf_decoder<STREAM>::execute_operator(qpdf_stream_instruction              op,
+  void pdf_decoder<STREAM>::execute_operator(qpdf_stream_instruction&             op,
                                              std::vector<qpdf_stream_instruction>& parameters)
   {
-    pdf_operator::operator_name name = pdf_operator::to_name(op.val);
+    // the operator is resolved once, when the stream is tokenized
+    pdf_operator::operator_name name = op.op;
 
     switch(name)
       {
@@ -1115,15 +1216,19 @@ namespace pdflib
 
       case pdf_operator::null:
         {
-          LOG_S(WARNING) << "unknown operator with name: " << op.val;
-          unknown_operators.insert(op.val);
+          std::string op_name = op.get_operator_name();
+
+          LOG_S(WARNING) << "unknown operator with name: " << op_name;
+          unknown_operators.insert(op_name);
         }
         break;
 
       default:
         {
-          LOG_S(WARNING) << "ignored operator with name: " << op.val;
-          unknown_operators.insert(op.val);
+          std::string op_name = op.get_operator_name();
+
+          LOG_S(WARNING) << "ignored operator with name: " << op_name;
+          unknown_operators.insert(op_name);
         }
       }
   }
@@ -192,114 +192,151 @@ namespace pdflib
     }
 
 
-    operator_name to_name(std::string name)
+    // Operator names are at most three characters long, so we dispatch
+    // on the length and then on the characters instead of comparing the
+    // name against every known operator.
+    operator_name to_name(const char* name, size_t len)
     {
-      // General graphics state
-      if(name=="w") { return w; }
-      else if(name=="J") { return J; }
-      else if(name=="j") { return j; }
-      else if(name=="M") { return M; }
-      else if(name=="d") { return d; }
-      else if(name=="ri") { return ri; }
-      else if(name=="i") { return i; }
-      else if(name=="gs") { return gs; }
-
-      // Special graphics state
-      else if(name=="q") { return q; }
-      else if(name=="Q") { return Q; }
-      else if(name=="cm") { return cm; }
-
-      // color-scheme
-      else if(name=="CS") { return CS; }
-      else if(name=="cs") { return cs; }
-
-      else if(name=="SC") { return SC; }
-      else if(name=="SCN") { return SCN; }
-      else if(name=="sc") { return sc; }
-      else if(name=="scn") { return scn; }
-
-      else if(name=="G") { return G; }
-      else if(name=="g") { return g; }
-
-      else if(name=="RG") { return RG; }
-      else if(name=="rg") { return rg; }
-
-      else if(name=="K") { return K; }
-      else if(name=="k") { return k; }
-
-      // XObjects
-      else if(name=="Do") { return Do; }
-
-      // text objects
-      else if(name=="BT") { return BT; }
-      else if(name=="ET") { return ET; }
-      else if(name=="BX") { return BX; }
-      else if(name=="EX") { return EX; }
-      else if(name=="BI") { return BI; }
-      else if(name=="ID") { return ID; }
-      else if(name=="EI") { return EI; }
+      switch(len)
+        {
+        case 1:
+          {
+            switch(name[0])
+              {
+              case 'w': return w;
+              case 'J': return J;
+              case 'j': return j;
+              case 'M': return M;
+              case 'd': return d;
+              case 'i': return i;
+              case 'q': return q;
+              case 'Q': return Q;
+              case 'G': return G;
+              case 'g': return g;
+              case 'K': return K;
+              case 'k': return k;
+              case '\'': return accent;
+              case '"':  return double_accent;
+              case 'm': return m;
+              case 'l': return l;
+              case 'c': return c;
+              case 'v': return v;
+              case 'y': return y;
+              case 'h': return h;
+              case 's': return s;
+              case 'S': return S;
+              case 'f': return f;
+              case 'F': return F;
+              case 'B': return B;
+              case 'b': return b;
+              case 'n': return n;
+              case 'W': return W;
+              default: break;
+              }
+          }
+          break;
 
-      // Text state
-      else if(name=="Tc") { return Tc; }
-      else if(name=="Tf") { return Tf; }
-      else if(name=="TL") { return TL; }
-      else if(name=="Ts") { return Ts; }
-      else if(name=="Tw") { return Tw; }
-      else if(name=="Tr") { return Tr; }
-      else if(name=="Tz") { return Tz; }
+        case 2:
+          {
+            char c0 = name[0];
+            char c1 = name[1];
+
+            switch(c0)
+              {
+              case 'T':
+                {
+                  switch(c1)
+                    {
+                    case 'c': return Tc;
+                    case 'f': return Tf;
+                    case 'L': return TL;
+                    case 's': return Ts;
+                    case 'w': return Tw;
+                    case 'r': return Tr;
+                    case 'z': return Tz;
+                    case 'd': return Td;
+                    case 'D': return TD;
+                    case 'm': return Tm;
+                    case '*': return TStar;
+                    case 'j': return Tj;
+                    case 'J': return TJ;
+                    default: break;
+                    }
+                }
+                break;
+
+              case 'B':
+                {
+                  if(c1=='T') { return BT; }
+                  else if(c1=='X') { return BX; }
+                  else if(c1=='I') { return BI; }
+                  else if(c1=='*') { return BStar; }
+                }
+                break;
+
+              case 'E':
+                {
+                  if(c1=='T') { return ET; }
+                  else if(c1=='X') { return EX; }
+                  else if(c1=='I') { return EI; }
+                }
+                break;
+
+              case 'd':
+                {
+                  if(c1=='0') { return d0; }
+                  else if(c1=='1') { return d1; }
+                }
+                break;
+
+              case 'r':
+                {
+                  if(c1=='i') { return ri; }
+                  else if(c1=='g') { return rg; }
+                  else if(c1=='e') { return re; }
+                }
+                break;
+
+              case 'g': { if(c1=='s') { return gs; } } break;
+              case 'c': { if(c1=='m') { return cm; } else if(c1=='s') { return cs; } } break;
+              case 'C': { if(c1=='S') { return CS; } } break;
+              case 'S': { if(c1=='C') { return SC; } } break;
+              case 's': { if(c1=='c') { return sc; } else if(c1=='h') { return sh; } } break;
+              case 'R': { if(c1=='G') { return RG; } } break;
+              case 'D': { if(c1=='o') { return Do; } else if(c1=='P') { return DP; } } break;
+              case 'I': { if(c1=='D') { return ID; } } break;
+              case 'M': { if(c1=='P') { return MP; } } break;
+              case 'f': { if(c1=='*') { return fStar; } } break;
+              case 'b': { if(c1=='*') { return bStar; } } break;
+              case 'W': { if(c1=='*') { return WStar; } } break;
+
+              default: break;
+              }
+          }
+          break;
 
-      // Text positioning
-      else if(name=="Td") { return Td; }
-      else if(name=="TD") { return TD; }
-      else if(name=="Tm") { return Tm; }
-      else if(name=="T*") { return TStar; }
+        case 3:
+          {
+            if(name[0]=='S' and name[1]=='C' and name[2]=='N') { return SCN; }
+            else if(name[0]=='s' and name[1]=='c' and name[2]=='n') { return scn; }
+            else if(name[0]=='B' and name[1]=='M' and name[2]=='C') { return BMC; }
+            else if(name[0]=='B' and name[1]=='D' and name[2]=='C') { return BDC; }
+            else if(name[0]=='E' and name[1]=='M' and name[2]=='C') { return EMC; }
+          }
+          break;
 
-      // Text showing
-      else if(name=="Tj") { return Tj; }
-      else if(name=="TJ") { return TJ; }
-      else if(name=="'")  { return accent; }
-      else if(name=="\"") { return double_accent; }
-
-      // path construction
-      else if(name=="m")  { return m; }
-      else if(name=="l")  { return l; }
-      else if(name=="c")  { return c; }
-      else if(name=="v")  { return v; }
-      else if(name=="y")  { return y; }
-      else if(name=="h")  { return h; }
-      else if(name=="re") { return re; }
-
-      // path painting
-      else if(name=="s")  { return s; }
-      else if(name=="S")  { return S; }
-      else if(name=="f")  { return f; }
-      else if(name=="F")  { return F; }
-      else if(name=="f*") { return fStar; }
-      else if(name=="B")  { return B; }
-      else if(name=="B*") { return BStar; }
-      else if(name=="b")  { return b; }
-      else if(name=="b*") { return bStar; }
-      else if(name=="n")  { return n; }
+        default:
+          break;
+        }
 
-      // Clipping paths
-      else if(name=="W")  { return W; }
-      else if(name=="W*")  { return WStar; }
+      // unknown operators are reported by the interpreter (tokens of
+      // other streams, eg CMaps, are typed with this function as well)
+      return null;
+    }
 
-      // Marked content
-      else if(name=="MP")  { return MP; }
-      else if(name=="DP")  { return DP; }
-      else if(name=="BMC")  { return BMC; }
-      else if(name=="BDC")  { return BDC; }
-      else if(name=="EMC")  { return EMC; }
-      else if(name=="sh")  { return sh; }
-      else if(name=="d0")  { return d0; }
-      else if(name=="d1")  { return d1; }
-
-      else
-        {
-          LOG_S(ERROR) << "unsupported operator with name: " << name;
-          return null;
-        }
+    operator_name to_name(const std::string& name)
+    {
+      return to_name(name.c_str(), name.size());
     }
 
     std::string to_string(operator_name name)
@@ -9,6 +9,7 @@ namespace pdflib
     
     PAGE_FONT,
     PAGE_FONTS,
+    DOCUMENT_FONTS,
     
     PAGE_GRPH,
     PAGE_GRPHS,
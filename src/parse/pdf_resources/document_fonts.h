@@ -0,0 +1,91 @@
+//-*-C++-*-
+
+#ifndef PDF_DOCUMENT_FONTS_RESOURCE_H
+#define PDF_DOCUMENT_FONTS_RESOURCE_H
+
+namespace pdflib
+{
+
+  // Document-wide cache of decoded fonts, shared by all pages (and form
+  // xobjects) of a document. Entries are immutable once inserted, so they
+  // can be handed out to concurrently decoded pages.
+  //
+  // Fonts decoded with and without their embedded programs are kept apart
+  // (see pdf_resource<PAGE_FONTS>::load_font), so a page that renders never
+  // gets a font whose program was left unextracted.
+  template<>
+  class pdf_resource<DOCUMENT_FONTS>
+  {
+    typedef std::shared_ptr<const pdf_resource<PAGE_FONT> > font_ptr_type;
+    typedef std::tuple<QPDFObjGen, std::string, bool> key_type;
+
+  public:
+
+    pdf_resource();
+    ~pdf_resource();
+
+    size_t size();
+
+    font_ptr_type find(QPDFObjGen const& og, std::string const& font_key,
+                       bool with_font_program);
+
+    // Returns the cached entry: if another page inserted the same font in
+    // the meantime, that one is kept and `font` is dropped.
+    font_ptr_type insert(QPDFObjGen const& og, std::string const& font_key,
+                         bool with_font_program, font_ptr_type font);
+
+    void clear();
+
+  private:
+
+    std::mutex fonts_mutex;
+    std::map<key_type, font_ptr_type> fonts;
+  };
+
+  pdf_resource<DOCUMENT_FONTS>::pdf_resource():
+    fonts({})
+  {}
+
+  pdf_resource<DOCUMENT_FONTS>::~pdf_resource()
+  {}
+
+  size_t pdf_resource<DOCUMENT_FONTS>::size()
+  {
+    std::lock_guard<std::mutex> lock(fonts_mutex);
+    return fonts.size();
+  }
+
+  pdf_resource<DOCUMENT_FONTS>::font_ptr_type
+  pdf_resource<DOCUMENT_FONTS>::find(QPDFObjGen const& og, std::string const& font_key,
+                                     bool with_font_program)
+  {
+    std::lock_guard<std::mutex> lock(fonts_mutex);
+
+    auto itr = fonts.find(key_type(og, font_key, with_font_program));
+    if(itr != fonts.end())
+      {
+        return itr->second;
+      }
+
+    return nullptr;
+  }
+
+  pdf_resource<DOCUMENT_FONTS>::font_ptr_type
+  pdf_resource<DOCUMENT_FONTS>::insert(QPDFObjGen const& og, std::string const& font_key,
+                                       bool with_font_program, font_ptr_type font)
+  {
+    std::lock_guard<std::mutex> lock(fonts_mutex);
+
+    auto result = fonts.emplace(key_type(og, font_key, with_font_program), font);
+    return (result.first)->second;
+  }
+
+  void pdf_resource<DOCUMENT_FONTS>::clear()
+  {
+    std::lock_guard<std::mutex> lock(fonts_mutex);
+    fonts.clear();
+  }
+
+}
+
+#endif
@@ -17,63 +17,73 @@ namespace pdflib
     
   public:
 
-    pdf_resource(pdf_timings& timings);
+    pdf_resource();
     ~pdf_resource();
 
     static void initialise(nlohmann::json                            data,
 			   std::unordered_map<std::string, double>& timings);
 
-    nlohmann::json get();
+    nlohmann::json get() const;
 
-    std::string get_encoding_name();
-    font_encoding_name get_encoding();
+    std::string get_encoding_name() const;
+    font_encoding_name get_encoding() const;
 
-    std::string get_key();
-    std::string get_name();
-    std::string get_base_font();
+    std::string get_key() const;
+    std::string get_name() const;
+    std::string get_base_font() const;
 
-    double      get_width(uint32_t c, bool verbose=true);
-    std::string get_string(uint32_t c);
+    // names shared by all the cells drawn with this font (see page_cell_font)
+    const std::shared_ptr<const page_cell_font>& get_cell_font() const;
 
-    double get_space_width();
-    double get_average_width();
+    double      get_width(uint32_t c, bool verbose=true) const;
+    std::string get_string(uint32_t c) const;
 
-    double get_ascent();
-    double get_descent();
+    double get_space_width() const;
+    double get_average_width() const;
 
-    double get_capheight();
-    double get_xheight();
-    bool has_char_bbox(const uint32_t& c);
-    std::array<double, 4> get_char_bbox(const uint32_t& c);
-    bool has_char_bbox(const std::string& c);
-    std::array<double, 4> get_char_bbox(const std::string& c);
+    double get_ascent() const;
+    double get_descent() const;
 
-    std::array<double, 4> get_font_bbox() { return font_bbox; }
+    double get_capheight() const;
+    double get_xheight() const;
+    bool has_char_bbox(const uint32_t& c) const;
+    std::array<double, 4> get_char_bbox(const uint32_t& c) const;
+    bool has_char_bbox(const std::string& c) const;
+    std::array<double, 4> get_char_bbox(const std::string& c) const;
+
+    std::array<double, 4> get_font_bbox() const { return font_bbox; }
     const embedded_font_program& get_font_program() const { return font_program; }
 
     // Lazily extracts the embedded font program (first call only) and returns
     // the shared render-facing blob; null when the font has no usable embedded
-    // program. All text instructions of this font share the same blob.
-    std::shared_ptr<const embedded_font_blob> get_embedded_font_blob();
+    // program. All text instructions of this font share the same blob. The
+    // extraction reads from the QPDF document the font was decoded from, so
+    // the first call must come from the thread that owns that document.
+    std::shared_ptr<const embedded_font_blob> get_embedded_font_blob() const;
+
+    // Skips the extraction: get_embedded_font_blob() returns null from now
+    // on, without reading the QPDF document. No-op once extracted.
+    void disable_embedded_font_blob() const;
 
     // Raw glyph name (no leading '/') that /Encoding /Differences assigns to
     // this character code; empty when the code has no override. Used by the
     // renderer for glyph-identity lookups in embedded font programs.
-    std::string get_glyph_name(uint32_t code);
+    std::string get_glyph_name(uint32_t code) const;
     
     std::string get_utf8_string(std::string line, bool is_hex_str);
 
     // only needed for the cmap-resource files
-    bool numb_is_in_cmap(uint32_t c); 
+    bool numb_is_in_cmap(uint32_t c) const; 
     
     void set(std::string      font_key_,
              nlohmann::json&  json_font_,
-             QPDFObjectHandle qpdf_font_);
+             QPDFObjectHandle qpdf_font_,
+             pdf_timings&     timings);
 
   private:
 
-    std::string get_correct_character(uint32_t c);
-    std::string get_character_from_encoding(uint32_t c);
+    std::string get_correct_character(uint32_t c) const;
+    std::string get_character_from_encoding(uint32_t c) const;
 
     void init_encoding();
     void init_subtype();
@@ -123,6 +133,10 @@ namespace pdflib
 
   private:
 
+    static std::mutex     init_mutex;
+
+    static font_resources resources;
+
     static font_glyphs    glyphs;
     static font_cids      cids;
     static font_encodings encodings;
@@ -130,8 +144,6 @@ namespace pdflib
 
   private:
 
-    pdf_timings& timings;
-    
     nlohmann::json   json_font;
     nlohmann::json   desc_font; // derived from json_font, only for '/Type-0'
 
@@ -179,22 +191,30 @@ namespace pdflib
     std::unordered_map<uint32_t, std::string> diff_numb_to_char;
     std::unordered_map<uint32_t, std::string> diff_numb_to_name;
 
-    std::unordered_map<uint32_t, int> unknown_numbs;
+    // only used for diagnostics; guarded since a decoded font can be shared
+    // by several pages (see pdf_resource<DOCUMENT_FONTS>)
+    mutable std::mutex unknown_numbs_mutex;
+    mutable std::unordered_map<uint32_t, int> unknown_numbs;
 
     uint32_t space_index;
     embedded_font_program font_program;
 
-    bool font_blob_initialized = false;
+    std::shared_ptr<const page_cell_font> cell_font;
+
+    mutable std::once_flag font_blob_once;
     std::shared_ptr<const embedded_font_blob> font_blob;
   };
 
+  std::mutex     pdf_resource<PAGE_FONT>::init_mutex;
+
+  font_resources pdf_resource<PAGE_FONT>::resources = font_resources();
+
   font_glyphs    pdf_resource<PAGE_FONT>::glyphs = font_glyphs();
   font_cids      pdf_resource<PAGE_FONT>::cids = font_cids();
   font_encodings pdf_resource<PAGE_FONT>::encodings = font_encodings();
   base_fonts     pdf_resource<PAGE_FONT>::bfonts = base_fonts();
 
-  pdf_resource<PAGE_FONT>::pdf_resource(pdf_timings& timings):
-    timings(timings)
+  pdf_resource<PAGE_FONT>::pdf_resource()
   {}
   
   pdf_resource<PAGE_FONT>::~pdf_resource()
@@ -239,12 +259,32 @@ namespace pdflib
 	throw std::logic_error(message);
       }
     
+    // the font resources are shared by all parsers in the process
+    std::lock_guard<std::mutex> lock(init_mutex);
+
     utils::timer timer;
+
+    {
+      timer.reset();
+
+      // compiled glyphs, encodings and base-fonts (falls back on the text
+      // files if missing)
+      resources.load(pdf_resources_dir+"font-resources.bin");
+
+      timings["init-font-resources"] = timer.get_time();
+    }
     
     {
       timer.reset();
 
-      glyphs.initialise(glyphs_dir);
+      if(resources.is_loaded())
+	{
+	  glyphs.initialise(resources.get_glyphs());
+	}
+      else
+	{
+	  glyphs.initialise(glyphs_dir);
+	}
 
       timings["init-glyphs"] = timer.get_time();
     }
@@ -260,7 +300,14 @@ namespace pdflib
     {
       timer.reset();
 
-      encodings.initialise(encodings_dir, glyphs);
+      if(resources.is_loaded())
+	{
+	  encodings.initialise(resources.get_encodings());
+	}
+      else
+	{
+	  encodings.initialise(encodings_dir, glyphs);
+	}
 
       timings["init-encodings"] = timer.get_time();
     }
@@ -268,53 +315,65 @@ namespace pdflib
     {
       timer.reset();
 
-      bfonts.initialise(bfonts_dir, glyphs);
+      if(resources.is_loaded())
+	{
+	  bfonts.initialise(resources.get_base_fonts(), glyphs);
+	}
+      else
+	{
+	  bfonts.initialise(bfonts_dir, glyphs);
+	}
 
       timings["init-bfonts"] = timer.get_time();
     }
   }
 
-  nlohmann::json pdf_resource<PAGE_FONT>::get()
+  nlohmann::json pdf_resource<PAGE_FONT>::get() const
   {
     return json_font;
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_encoding_name()
+  std::string pdf_resource<PAGE_FONT>::get_encoding_name() const
   {
     return encoding_name;
   }
 
-  font_encoding_name pdf_resource<PAGE_FONT>::get_encoding()
+  font_encoding_name pdf_resource<PAGE_FONT>::get_encoding() const
   {
     return encoding;
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_key()
+  std::string pdf_resource<PAGE_FONT>::get_key() const
   {
     return font_key;
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_name()
+  const std::shared_ptr<const page_cell_font>& pdf_resource<PAGE_FONT>::get_cell_font() const
+  {
+    return cell_font;
+  }
+
+  std::string pdf_resource<PAGE_FONT>::get_name() const
   {
     return font_name;
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_base_font()
+  std::string pdf_resource<PAGE_FONT>::get_base_font() const
   {
     return base_font;
   }
 
-  bool pdf_resource<PAGE_FONT>::numb_is_in_cmap(uint32_t v)
+  bool pdf_resource<PAGE_FONT>::numb_is_in_cmap(uint32_t v) const
   {
     //LOG_S(INFO) << "# cmap: " << cmap_numb_to_char.size();
     return (cmap_numb_to_char.count(v)==1);
   }
 
-  double pdf_resource<PAGE_FONT>::get_width(uint32_t c, bool verbose)
+  double pdf_resource<PAGE_FONT>::get_width(uint32_t c, bool verbose) const
   {
     if(numb_to_widths.count(c)==1)
       {
-        return numb_to_widths[c];
+        return numb_to_widths.at(c);
       }
     else if(has_default_width)
       {
@@ -365,7 +424,7 @@ namespace pdflib
     return 500.0;
   }
 
-  double pdf_resource<PAGE_FONT>::get_space_width()
+  double pdf_resource<PAGE_FONT>::get_space_width() const
   {
     //LOG_S(INFO) << __FUNCTION__ 
     //<< "\tspace-index: " << space_index 
@@ -380,33 +439,33 @@ namespace pdflib
     return 500.0;
   }
 
-  double pdf_resource<PAGE_FONT>::get_average_width()
+  double pdf_resource<PAGE_FONT>::get_average_width() const
   {
     LOG_S(WARNING) << "implement " << __FUNCTION__;
     return 500.0;
   }
 
-  double pdf_resource<PAGE_FONT>::get_ascent()
+  double pdf_resource<PAGE_FONT>::get_ascent() const
   {
     return ascent;
   }
 
-  double pdf_resource<PAGE_FONT>::get_descent()
+  double pdf_resource<PAGE_FONT>::get_descent() const
   {
     return descent;
   }
 
-  double pdf_resource<PAGE_FONT>::get_capheight()
+  double pdf_resource<PAGE_FONT>::get_capheight() const
   {
     return capheight;
   }
 
-  double pdf_resource<PAGE_FONT>::get_xheight()
+  double pdf_resource<PAGE_FONT>::get_xheight() const
   {
     return xheight;
   }
 
-  bool pdf_resource<PAGE_FONT>::has_char_bbox(const uint32_t& c)
+  bool pdf_resource<PAGE_FONT>::has_char_bbox(const uint32_t& c) const
   {
     if(bfonts.has_corresponding_font(font_name) or
        bfonts.has_corresponding_font(base_font))
@@ -422,7 +481,7 @@ namespace pdflib
     return false;
   }
 
-  std::array<double, 4> pdf_resource<PAGE_FONT>::get_char_bbox(const uint32_t& c)
+  std::array<double, 4> pdf_resource<PAGE_FONT>::get_char_bbox(const uint32_t& c) const
   {
     std::string fontname = bfonts.has_corresponding_font(font_name)
       ? bfonts.get_corresponding_font(font_name)
@@ -432,7 +491,7 @@ namespace pdflib
     return bfont.get_char_bbox(c);
   }
 
-  bool pdf_resource<PAGE_FONT>::has_char_bbox(const std::string& c)
+  bool pdf_resource<PAGE_FONT>::has_char_bbox(const std::string& c) const
   {
     if(bfonts.has_corresponding_font(font_name) or
        bfonts.has_corresponding_font(base_font))
@@ -448,7 +507,7 @@ namespace pdflib
     return false;
   }
 
-  std::array<double, 4> pdf_resource<PAGE_FONT>::get_char_bbox(const std::string& c)
+  std::array<double, 4> pdf_resource<PAGE_FONT>::get_char_bbox(const std::string& c) const
   {
     std::string fontname = bfonts.has_corresponding_font(font_name)
       ? bfonts.get_corresponding_font(font_name)
@@ -458,7 +517,7 @@ namespace pdflib
     return bfont.get_char_bbox(c);
   }
   
-  std::string pdf_resource<PAGE_FONT>::get_string(uint32_t c)
+  std::string pdf_resource<PAGE_FONT>::get_string(uint32_t c) const
   {
     //LOG_S(INFO) << __FUNCTION__ << "\t" << c;
 
@@ -540,7 +599,7 @@ namespace pdflib
       }
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_correct_character(uint32_t c)
+  std::string pdf_resource<PAGE_FONT>::get_correct_character(uint32_t c) const
   {
     // For codes covered by /Encoding/Differences, diff_numb_to_char
     // already encodes the precedence of PDF 32000-1 section 9.10.2:
@@ -617,7 +676,7 @@ namespace pdflib
       }
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_character_from_encoding(uint32_t c)
+  std::string pdf_resource<PAGE_FONT>::get_character_from_encoding(uint32_t c) const
   {
     auto& base_encoding = encodings.get(encoding).get_numb_to_utf8();
 
@@ -649,7 +708,10 @@ namespace pdflib
           {
             std::string notdef="GLYPH<"+std::to_string(c)+">";
 
-            unknown_numbs[c] += 1;
+            {
+              std::lock_guard<std::mutex> lock(unknown_numbs_mutex);
+              unknown_numbs[c] += 1;
+            }
 
             LOG_S(ERROR) << "Symbol not found: " << int(c)
                          << "; Encoding: "  << to_string(encoding)
@@ -662,7 +724,8 @@ namespace pdflib
 
   void pdf_resource<PAGE_FONT>::set(std::string      font_key_,
                                     nlohmann::json&  json_font_,
-                                    QPDFObjectHandle qpdf_font_)
+                                    QPDFObjectHandle qpdf_font_,
+                                    pdf_timings&     timings)
   {
     LOG_S(INFO) << __FUNCTION__ << " font: " << font_key_;
 
@@ -753,6 +816,11 @@ namespace pdflib
     
     unknown_numbs.clear();
 
+    cell_font = std::make_shared<const page_cell_font>(encoding_name,
+                                                       to_string(encoding),
+                                                       font_key,
+                                                       font_name);
+
     /*
       if(true)
       {
@@ -1363,20 +1431,27 @@ namespace pdflib
                 << " declared_subtype=" << font_program.declared_subtype;
   }
 
-  std::shared_ptr<const embedded_font_blob> pdf_resource<PAGE_FONT>::get_embedded_font_blob()
+  std::shared_ptr<const embedded_font_blob> pdf_resource<PAGE_FONT>::get_embedded_font_blob() const
   {
-    if(not font_blob_initialized)
-      {
-        font_blob_initialized = true;
+    std::call_once(font_blob_once, [this]()
+    {
+      // the extraction only fills font_program and font_blob, which are
+      // otherwise never modified after set()
+      auto self = const_cast<pdf_resource<PAGE_FONT>*>(this);
 
-        init_font_program();
-        build_embedded_font_blob();
-      }
+      self->init_font_program();
+      self->build_embedded_font_blob();
+    });
 
     return font_blob;
   }
 
-  std::string pdf_resource<PAGE_FONT>::get_glyph_name(uint32_t code)
+  void pdf_resource<PAGE_FONT>::disable_embedded_font_blob() const
+  {
+    std::call_once(font_blob_once, []() {});
+  }
+
+  std::string pdf_resource<PAGE_FONT>::get_glyph_name(uint32_t code) const
   {
     auto itr = diff_numb_to_name.find(code);
     if(itr != diff_numb_to_name.end())
@@ -2079,13 +2154,13 @@ namespace pdflib
 
 	LOG_S(INFO) << "encoding-name: " << encoding_name;
 
-	if(cids.decode_cmap_resource(encoding_name))
+	std::shared_ptr<const font_cid> cid = cids.get(encoding_name);
+
+	if(cid)
 	  {
-	    font_cid& cid = cids.get(encoding_name);
-	
-	    cmap_numb_to_char = cid.get();	
+	    cmap_numb_to_char = cid->get();	
 
-	    cid.decode_widths(numb_to_widths);	
+	    cid->decode_widths(numb_to_widths);	
 
 	    cmap_initialized = true;	    
 	  }
@@ -2152,13 +2227,13 @@ namespace pdflib
 	    cmap_initialized = true;	    
 	  }
 	*/
-	if(cids.decode_cmap_resource(encoding_name))
+	std::shared_ptr<const font_cid> cid = cids.get(encoding_name);
+
+	if(cid)
 	  {
-	    font_cid& cid = cids.get(encoding_name);
-	
-	    cmap_numb_to_char = cid.get();	
+	    cmap_numb_to_char = cid->get();	
 
-	    cid.decode_widths(numb_to_widths);	
+	    cid->decode_widths(numb_to_widths);	
 
 	    cmap_initialized = true;	    
 	  }
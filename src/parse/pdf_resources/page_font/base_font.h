@@ -16,6 +16,10 @@ namespace pdflib
     base_font(std::string filename_,
 	      font_glyphs& glyphs_);
 
+    // font from the compiled font-resources (see base_fonts::initialise)
+    base_font(utils::binary::reader record_,
+	      font_glyphs& glyphs_);
+
     base_font(const base_font& other);
 
     ~base_font();
@@ -47,12 +51,24 @@ namespace pdflib
 
     void initialise();
 
+    void write(utils::binary::writer& writer);
+
+  private:
+
+    void read_file();
+    void read_record();
+
   private:
 
     std::string filename;
+    utils::binary::reader record;
+
     font_glyphs& glyphs;
 
-    bool initialised;
+    // base-fonts are shared by all parsers and initialised on first use,
+    // possibly from concurrently decoded pages
+    std::mutex        init_mutex;
+    std::atomic<bool> initialised;
 
     nlohmann::json properties;
     
@@ -73,8 +89,17 @@ namespace pdflib
     initialised(false)
   {}
 
+  base_font::base_font(utils::binary::reader record_,
+		       font_glyphs& glyphs_):
+    filename("compiled"),
+    record(record_),
+    glyphs(glyphs_),
+    initialised(false)
+  {}
+
   base_font::base_font(const base_font& other):
     filename(other.filename),
+    record(other.record),
     glyphs(other.glyphs),
     initialised(false)
   {}
@@ -84,8 +109,9 @@ namespace pdflib
 
   base_font& base_font::operator=(const base_font& other)
   {
+    // glyphs is a reference to the shared glyph-table, it is not copied
     this->filename = other.filename;
-    this->glyphs = other.glyphs;
+    this->record = other.record;
 
     initialised = false;
 
@@ -291,8 +317,113 @@ namespace pdflib
       {
 	return;
       }
+
+    std::lock_guard<std::mutex> lock(init_mutex);
+
+    if(initialised)
+      {
+	return;
+      }
+
+    if(record.data()!=NULL)
+      {
+        read_record();
+      }
+    else
+      {
+        read_file();
+      }
+
     initialised = true;
+  }
+
+  void base_font::read_record()
+  {
+    LOG_S(INFO) << "initialising compiled base-font";
+
+    utils::binary::reader reader = record;
+
+    properties = nlohmann::json::from_cbor(reader.read_string());
+
+    uint32_t num_chars = reader.read_uint32();
+    for(uint32_t l=0; l<num_chars; l++)
+      {
+        uint32_t    uc   = reader.read_uint32();
+        std::string name = reader.read_string();
+        std::string utf8 = reader.read_string();
+        double      wval = reader.read_double();
+
+        numb_to_name[uc] = name;
+        numb_to_utf8[uc] = utf8;
+
+        numb_to_width[uc] = wval;
+        name_to_width[name] = wval;
 
+        if(reader.read_uint32()==1)
+          {
+            std::array<double, 4> bbox;
+            for(int k=0; k<4; k++)
+              {
+                bbox[k] = reader.read_double();
+              }
+
+            numb_to_bbox[uc] = bbox;
+            name_to_bbox[name] = bbox;
+          }
+      }
+
+    // stored separately: it depends on the order of the chars in the file
+    uint32_t num_utf8 = reader.read_uint32();
+    for(uint32_t l=0; l<num_utf8; l++)
+      {
+        std::string utf8 = reader.read_string();
+        utf8_to_numb[utf8] = reader.read_uint32();
+      }
+  }
+
+  void base_font::write(utils::binary::writer& writer)
+  {
+    initialise();
+
+    // cbor, since the properties might not be valid utf8
+    std::vector<std::uint8_t> cbor = nlohmann::json::to_cbor(properties);
+    writer.write_string(std::string(cbor.begin(), cbor.end()));
+
+    writer.write_uint32(numb_to_name.size());
+    for(auto itr=numb_to_name.begin(); itr!=numb_to_name.end(); itr++)
+      {
+        uint32_t uc = itr->first;
+
+        writer.write_uint32(uc);
+        writer.write_string(itr->second);
+        writer.write_string(numb_to_utf8.at(uc));
+        writer.write_double(numb_to_width.at(uc));
+
+        auto bbox = numb_to_bbox.find(uc);
+        if(bbox!=numb_to_bbox.end())
+          {
+            writer.write_uint32(1);
+            for(int k=0; k<4; k++)
+              {
+                writer.write_double((bbox->second)[k]);
+              }
+          }
+        else
+          {
+            writer.write_uint32(0);
+          }
+      }
+
+    writer.write_uint32(utf8_to_numb.size());
+    for(auto itr=utf8_to_numb.begin(); itr!=utf8_to_numb.end(); itr++)
+      {
+        writer.write_string(itr->first);
+        writer.write_uint32(itr->second);
+      }
+  }
+
+  void base_font::read_file()
+  {
     LOG_S(WARNING) << "initialising base-font: " << filename;
     
     std::ifstream file(filename.c_str());
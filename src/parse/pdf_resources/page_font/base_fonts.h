@@ -36,6 +36,11 @@ namespace pdflib
     template<typename glyphs_type>
     void initialise(std::string filename, glyphs_type& glyphs);
 
+    // initialise from / write to the compiled font-resources (see
+    // font_resources). The metrics of the fonts are only read on first use.
+    void initialise(utils::binary::reader reader, font_glyphs& glyphs);
+    void write(utils::binary::writer& writer);
+
   private:
 
     std::string normalise(std::string font_name);
@@ -243,6 +248,48 @@ namespace pdflib
     initialized = true;
   }
 
+  void base_fonts::initialise(utils::binary::reader reader, font_glyphs& glyphs)
+  {
+    if(initialized)
+      {
+	LOG_S(WARNING) << "skipping base_fonts::initialise, already initialized ...";
+	return;
+      }
+
+    uint32_t num_fonts = reader.read_uint32();
+    for(uint32_t l=0; l<num_fonts; l++)
+      {
+        std::string fontname = reader.read_string();
+        bool        is_core  = (reader.read_uint32()==1);
+
+        base_font bf(reader.read_blob(), glyphs);
+        name_to_basefont.emplace(std::pair<std::string, base_font>(fontname, bf));
+
+        if(is_core)
+          {
+            core_14_fonts.insert(fontname);
+          }
+      }
+
+    initialized = true;
+  }
+
+  void base_fonts::write(utils::binary::writer& writer)
+  {
+    writer.write_uint32(name_to_basefont.size());
+
+    for(auto itr=name_to_basefont.begin(); itr!=name_to_basefont.end(); itr++)
+      {
+        writer.write_string(itr->first);
+        writer.write_uint32(core_14_fonts.count(itr->first));
+
+        utils::binary::writer record;
+        (itr->second).write(record);
+
+        writer.write_string(record.get());
+      }
+  }
+
   std::string base_fonts::read_fontname(std::string filename)
   {
     std::string fontname = "unknown";
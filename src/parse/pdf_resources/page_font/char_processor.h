@@ -39,13 +39,13 @@ namespace pdflib
 
     for(auto& item:instructions)
       {
-        if(item.key!="operator")
+        if(not item.is_operator())
           {
             parameters.push_back(item);
           }
         else
           {
-            if(item.val=="Char_ProcessName")
+            if(item.get_operator_name()=="Char_ProcessName")
               }
       }
     */
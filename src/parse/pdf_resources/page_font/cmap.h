@@ -142,9 +142,9 @@ namespace pdflib
 
     for(auto& item:instructions)
       {
-	//LOG_S(INFO) << item.key << ": " << item.val;
+	//LOG_S(INFO) << item.key() << ": " << item.val();
 
-        if(item.key!="operator")
+        if(not item.is_operator())
           {
             parameters.push_back(item);
           }
@@ -156,7 +156,7 @@ namespace pdflib
 	    // strip the suffix so the dispatch below recognises it.
 	    // The suffix integer is injected at the front of parameters so it
 	    // becomes the first argument for the next operator.
-	    std::string op_name   = item.val;
+	    std::string op_name   = item.get_operator_name();
 	    std::string op_suffix = "";
 	    for(const auto& known : known_operators)
 	      {
@@ -177,7 +177,7 @@ namespace pdflib
 	          }
 	      }
 
-	    LOG_S(INFO) << item.key << ": " << op_name;
+	    LOG_S(INFO) << item.key() << ": " << op_name;
 
             if(op_name=="CMapName")
               {
@@ -232,11 +232,7 @@ namespace pdflib
 	    if(!op_suffix.empty())
 	      {
 	        auto inj_obj = QPDFObjectHandle::newInteger(std::stoll(op_suffix));
-	        qpdf_stream_instruction inj;
-	        inj.obj = inj_obj;
-	        inj.key = "integer";
-	        inj.val = op_suffix;
-	        parameters.insert(parameters.begin(), inj);
+	        parameters.insert(parameters.begin(), qpdf_stream_instruction(inj_obj));
 	        LOG_S(INFO) << "cmap: injected suffix '" << op_suffix
 	                    << "' as parameter for next operator";
 	      }
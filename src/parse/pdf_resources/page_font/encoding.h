@@ -23,6 +23,11 @@ namespace pdflib
     void initialise(font_encoding_name name_, 
                     std::string file_name,
                      glyphs_type& glyphs);
+
+    void initialise(font_encoding_name name_,
+                    utils::binary::reader& reader);
+
+    void write(utils::binary::writer& writer);
     
 
   private:
@@ -78,6 +83,33 @@ namespace pdflib
       }
   }
 
+  void font_encoding::initialise(font_encoding_name name_,
+                                 utils::binary::reader& reader)
+  {
+    name = name_;
+
+    uint32_t num_chars = reader.read_uint32();
+    for(uint32_t l=0; l<num_chars; l++)
+      {
+        uint32_t ind = reader.read_uint32();
+
+        numb_to_name[ind] = reader.read_string();
+        numb_to_utf8[ind] = reader.read_string();
+      }
+  }
+
+  void font_encoding::write(utils::binary::writer& writer)
+  {
+    writer.write_uint32(numb_to_name.size());
+
+    for(auto itr=numb_to_name.begin(); itr!=numb_to_name.end(); itr++)
+      {
+        writer.write_uint32(itr->first);
+        writer.write_string(itr->second);
+        writer.write_string(numb_to_utf8.at(itr->first));
+      }
+  }
+
 }
 
 #endif
@@ -19,6 +19,10 @@ namespace pdflib
     template<typename glyphs_type>
     void initialise(std::string dirname, glyphs_type& glyphs);
 
+    // initialise from / write to the compiled font-resources (see font_resources)
+    void initialise(utils::binary::reader reader);
+    void write(utils::binary::writer& writer);
+
   private:
 
     bool initialized;
@@ -63,6 +67,37 @@ namespace pdflib
     initialized = true;
   }
 
+  void font_encodings::initialise(utils::binary::reader reader)
+  {
+    if(initialized)
+      {
+	LOG_S(WARNING) << "skipping font_encodings::initialise, already initialized ...";
+	return;
+      }
+
+    uint32_t num_encodings = reader.read_uint32();
+    for(uint32_t l=0; l<num_encodings; l++)
+      {
+        font_encoding_name name = static_cast<font_encoding_name>(reader.read_uint32());
+
+        font_encoding& encoding = name_to_encoding[name];
+        encoding.initialise(name, reader);
+      }
+
+    initialized = true;
+  }
+
+  void font_encodings::write(utils::binary::writer& writer)
+  {
+    writer.write_uint32(name_to_encoding.size());
+
+    for(auto itr=name_to_encoding.begin(); itr!=name_to_encoding.end(); itr++)
+      {
+        writer.write_uint32(static_cast<uint32_t>(itr->first));
+        (itr->second).write(writer);
+      }
+  }
+
 }
 
 #endif
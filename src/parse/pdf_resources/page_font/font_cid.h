@@ -20,23 +20,30 @@ namespace pdflib
     font_cid();
     ~font_cid();
 
-    std::unordered_map<uint32_t, std::string>& get();
+    const std::unordered_map<uint32_t, std::string>& get() const;
+
+    const std::unordered_map<uint32_t, uint32_t>&    get_cmap2cid() const;
+    const std::unordered_map<uint32_t, std::string>& get_cid2utf8() const;
 
     void decode_cmap_resource(std::string filename,
                               std::string cid2code,
                               std::vector<std::string> columns);
 
-    void decode_widths(std::unordered_map<uint32_t, double>& numb_to_widths);
+    // add a single code, used when the cmap comes from a compiled table
+    // (see font_cid_table). A NULL utf8 means the cid has no unicode.
+    void add_code(uint32_t code, uint32_t cid, const char* utf8, size_t len);
 
-  private:
-
-    std::vector<std::string> split(std::string line, char delim='\t');
+    void decode_widths(std::unordered_map<uint32_t, double>& numb_to_widths) const;
 
     void read_cmap2cid(std::string filename);
 
     void read_cid2code(std::string              filename,
                        std::vector<std::string> columns);
 
+  private:
+
+    std::vector<std::string> split(std::string line, char delim='\t');
+
   private:
 
     std::unordered_map<uint32_t, uint32_t>    cmap2cid;
@@ -51,11 +58,31 @@ namespace pdflib
   font_cid::~font_cid()
   {}
 
-  std::unordered_map<uint32_t, std::string>& font_cid::get()
+  const std::unordered_map<uint32_t, std::string>& font_cid::get() const
   {
     return cmap2str;
   }
 
+  const std::unordered_map<uint32_t, uint32_t>& font_cid::get_cmap2cid() const
+  {
+    return cmap2cid;
+  }
+
+  const std::unordered_map<uint32_t, std::string>& font_cid::get_cid2utf8() const
+  {
+    return cid2utf8;
+  }
+
+  void font_cid::add_code(uint32_t code, uint32_t cid, const char* utf8, size_t len)
+  {
+    cmap2cid[code] = cid;
+
+    if(utf8!=NULL)
+      {
+        cmap2str[code] = std::string(utf8, len);
+      }
+  }
+
   std::vector<std::string> font_cid::split(std::string line,
                                            char        delim)
   {
@@ -307,7 +334,7 @@ namespace pdflib
       }
   }
 
-  void font_cid::decode_widths(std::unordered_map<uint32_t, double>& numb_to_widths)
+  void font_cid::decode_widths(std::unordered_map<uint32_t, double>& numb_to_widths) const
   {
     LOG_S(INFO) << __FUNCTION__;
 
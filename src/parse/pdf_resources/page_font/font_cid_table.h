@@ -0,0 +1,370 @@
+//-*-C++-*-
+
+#ifndef PDF_PAGE_FONT_CID_TABLE_H
+#define PDF_PAGE_FONT_CID_TABLE_H
+
+#include <cstring>
+
+namespace pdflib
+{
+
+  // Compiled form of the Adobe cmap-resources (see font_cids::compile and
+  // app/compile_resources.cpp). It is written once at build time and memory
+  // mapped at runtime, so the lookups are read-only and need no locking.
+  //
+  // Layout (all fields are uint32_t in native byte-order):
+  //
+  //   header      : magic, version, #collections, #cmaps, #ranges, #cids, #bytes, 0
+  //   collections : {name-offset, name-length, first-cid-entry, #cid-entries}
+  //   cmaps       : {name-offset, name-length, collection, first-range, #ranges}  (sorted by name)
+  //   ranges      : {first-code, last-code, first-cid}
+  //   cids        : {utf8-offset, utf8-length}  (utf8-offset==NO_UTF8 if unknown)
+  //   bytes       : names and utf8 strings
+  class font_cid_table
+  {
+    const static uint32_t MAGIC   = 0x4d435044; // "DPCM"
+    const static uint32_t VERSION = 1;
+
+    const static uint32_t NO_UTF8 = 0xffffffff;
+
+    const static size_t HEADER_SIZE     = 8;
+    const static size_t COLLECTION_SIZE = 4;
+    const static size_t CMAP_SIZE       = 5;
+    const static size_t RANGE_SIZE      = 3;
+    const static size_t CID_SIZE        = 2;
+
+  public:
+
+    font_cid_table();
+    ~font_cid_table();
+
+    // runtime
+
+    bool load(std::string filename);
+
+    bool is_loaded() const;
+
+    bool has(std::string cmap_name) const;
+
+    bool decode(std::string cmap_name, font_cid& cid) const;
+
+    // build time
+
+    void add_collection(std::string name,
+                        const std::unordered_map<uint32_t, std::string>& cid2utf8);
+
+    void add_cmap(std::string name, std::string collection,
+                  const std::unordered_map<uint32_t, uint32_t>& cmap2cid);
+
+    bool write(std::string filename);
+
+  private:
+
+    static std::string strip_name(std::string name);
+
+    uint32_t add_bytes(const std::string& bytes);
+
+    const uint32_t* find_cmap(std::string cmap_name) const;
+
+  private:
+
+    utils::filesystem::mapped_file file;
+
+    const uint32_t* header;
+    const uint32_t* collections;
+    const uint32_t* cmaps;
+    const uint32_t* ranges;
+    const uint32_t* cids;
+    const char*     bytes;
+
+    // tables that are being compiled
+    std::map<std::string, uint32_t>  collection_index;
+    std::vector<uint32_t>            collection_table;
+    std::map<std::string, std::vector<uint32_t> > cmap_table;
+    std::vector<uint32_t>            range_table;
+    std::vector<uint32_t>            cid_table;
+    std::string                      byte_table;
+  };
+
+  font_cid_table::font_cid_table():
+    header(NULL),
+    collections(NULL),
+    cmaps(NULL),
+    ranges(NULL),
+    cids(NULL),
+    bytes(NULL)
+  {}
+
+  font_cid_table::~font_cid_table()
+  {}
+
+  std::string font_cid_table::strip_name(std::string name)
+  {
+    if(name.size()>0 and name.front()=='/')
+      {
+        return name.substr(1);
+      }
+
+    return name;
+  }
+
+  bool font_cid_table::load(std::string filename)
+  {
+    if(not file.open(filename))
+      {
+        LOG_S(INFO) << "no compiled cmap-table at " << filename;
+        return false;
+      }
+
+    const uint32_t* data = reinterpret_cast<const uint32_t*>(file.data());
+    size_t size = file.size();
+
+    if(size<HEADER_SIZE*sizeof(uint32_t) or
+       data[0]!=MAGIC or data[1]!=VERSION)
+      {
+        LOG_S(WARNING) << "ignoring incompatible cmap-table at " << filename;
+
+        file.close();
+        return false;
+      }
+
+    size_t num_words = HEADER_SIZE +
+      data[2]*COLLECTION_SIZE +
+      data[3]*CMAP_SIZE +
+      data[4]*RANGE_SIZE +
+      data[5]*CID_SIZE;
+
+    if(size!=num_words*sizeof(uint32_t)+data[6])
+      {
+        LOG_S(WARNING) << "ignoring truncated cmap-table at " << filename;
+
+        file.close();
+        return false;
+      }
+
+    header      = data;
+    collections = header + HEADER_SIZE;
+    cmaps       = collections + header[2]*COLLECTION_SIZE;
+    ranges      = cmaps + header[3]*CMAP_SIZE;
+    cids        = ranges + header[4]*RANGE_SIZE;
+    bytes       = reinterpret_cast<const char*>(cids + header[5]*CID_SIZE);
+
+    LOG_S(INFO) << "loaded cmap-table with " << header[3] << " cmaps from " << filename;
+
+    return true;
+  }
+
+  bool font_cid_table::is_loaded() const
+  {
+    return (header!=NULL);
+  }
+
+  const uint32_t* font_cid_table::find_cmap(std::string cmap_name) const
+  {
+    if(header==NULL)
+      {
+        return NULL;
+      }
+
+    std::string name = strip_name(cmap_name);
+
+    // cmaps are sorted by name
+    size_t beg=0, end=header[3];
+    while(beg<end)
+      {
+        size_t mid = (beg+end)/2;
+
+        const uint32_t* cmap = cmaps + mid*CMAP_SIZE;
+        int cmp = name.compare(0, std::string::npos, bytes+cmap[0], cmap[1]);
+
+        if(cmp==0)
+          {
+            return cmap;
+          }
+        else if(cmp<0)
+          {
+            end = mid;
+          }
+        else
+          {
+            beg = mid+1;
+          }
+      }
+
+    return NULL;
+  }
+
+  bool font_cid_table::has(std::string cmap_name) const
+  {
+    return (find_cmap(cmap_name)!=NULL);
+  }
+
+  bool font_cid_table::decode(std::string cmap_name, font_cid& cid) const
+  {
+    const uint32_t* cmap = find_cmap(cmap_name);
+
+    if(cmap==NULL)
+      {
+        return false;
+      }
+
+    const uint32_t* collection = collections + cmap[2]*COLLECTION_SIZE;
+
+    const uint32_t* cid_entries = cids + collection[2]*CID_SIZE;
+    uint32_t        num_cids    = collection[3];
+
+    for(uint32_t l=0; l<cmap[4]; l++)
+      {
+        const uint32_t* range = ranges + (cmap[3]+l)*RANGE_SIZE;
+
+        for(uint32_t code=range[0], ind=range[2]; code<=range[1]; code++, ind++)
+          {
+            const uint32_t* entry = (ind<num_cids)? (cid_entries + ind*CID_SIZE) : NULL;
+
+            if(entry!=NULL and entry[0]!=NO_UTF8)
+              {
+                cid.add_code(code, ind, bytes+entry[0], entry[1]);
+              }
+            else
+              {
+                cid.add_code(code, ind, NULL, 0);
+              }
+
+            if(code==range[1]) // avoid overflow for code=0xffffffff
+              {
+                break;
+              }
+          }
+      }
+
+    return true;
+  }
+
+  uint32_t font_cid_table::add_bytes(const std::string& str)
+  {
+    uint32_t offset = byte_table.size();
+    byte_table += str;
+
+    return offset;
+  }
+
+  void font_cid_table::add_collection(std::string name,
+                                      const std::unordered_map<uint32_t, std::string>& cid2utf8)
+  {
+    uint32_t max_cid = 0;
+    for(auto itr=cid2utf8.begin(); itr!=cid2utf8.end(); itr++)
+      {
+        max_cid = std::max(max_cid, itr->first);
+      }
+
+    uint32_t num_cids = (cid2utf8.size()>0)? (max_cid+1) : 0;
+
+    collection_index[name] = collection_table.size()/COLLECTION_SIZE;
+
+    collection_table.push_back(add_bytes(name));
+    collection_table.push_back(name.size());
+    collection_table.push_back(cid_table.size()/CID_SIZE);
+    collection_table.push_back(num_cids);
+
+    for(uint32_t ind=0; ind<num_cids; ind++)
+      {
+        auto itr = cid2utf8.find(ind);
+
+        if(itr!=cid2utf8.end())
+          {
+            cid_table.push_back(add_bytes(itr->second));
+            cid_table.push_back((itr->second).size());
+          }
+        else
+          {
+            cid_table.push_back(NO_UTF8);
+            cid_table.push_back(0);
+          }
+      }
+  }
+
+  void font_cid_table::add_cmap(std::string name, std::string collection,
+                                const std::unordered_map<uint32_t, uint32_t>& cmap2cid)
+  {
+    if(collection_index.count(collection)==0)
+      {
+        LOG_S(ERROR) << "unknown collection " << collection << " for cmap " << name;
+        return;
+      }
+
+    std::map<uint32_t, uint32_t> sorted(cmap2cid.begin(), cmap2cid.end());
+
+    std::vector<uint32_t> cmap = {
+      add_bytes(strip_name(name)),
+      static_cast<uint32_t>(strip_name(name).size()),
+      collection_index.at(collection),
+      static_cast<uint32_t>(range_table.size()/RANGE_SIZE),
+      0
+    };
+
+    // collapse consecutive codes with consecutive cids into ranges
+    for(auto itr=sorted.begin(); itr!=sorted.end(); itr++)
+      {
+        size_t num = range_table.size();
+
+        if(cmap[4]>0 and
+           range_table.at(num-2)+1==itr->first and
+           range_table.at(num-1)+(itr->first-range_table.at(num-3))==itr->second)
+          {
+            range_table.at(num-2) = itr->first;
+          }
+        else
+          {
+            range_table.push_back(itr->first);
+            range_table.push_back(itr->first);
+            range_table.push_back(itr->second);
+
+            cmap[4] += 1;
+          }
+      }
+
+    cmap_table[strip_name(name)] = cmap;
+  }
+
+  bool font_cid_table::write(std::string filename)
+  {
+    std::vector<uint32_t> data = {
+      MAGIC, VERSION,
+      static_cast<uint32_t>(collection_table.size()/COLLECTION_SIZE),
+      static_cast<uint32_t>(cmap_table.size()),
+      static_cast<uint32_t>(range_table.size()/RANGE_SIZE),
+      static_cast<uint32_t>(cid_table.size()/CID_SIZE),
+      static_cast<uint32_t>(byte_table.size()),
+      0
+    };
+
+    data.insert(data.end(), collection_table.begin(), collection_table.end());
+
+    for(auto itr=cmap_table.begin(); itr!=cmap_table.end(); itr++)
+      {
+        data.insert(data.end(), (itr->second).begin(), (itr->second).end());
+      }
+
+    data.insert(data.end(), range_table.begin(), range_table.end());
+    data.insert(data.end(), cid_table.begin(), cid_table.end());
+
+    std::ofstream ofs(filename, std::ios::binary);
+    if(not ofs)
+      {
+        LOG_S(ERROR) << "could not write cmap-table to " << filename;
+        return false;
+      }
+
+    ofs.write(reinterpret_cast<const char*>(data.data()), data.size()*sizeof(uint32_t));
+    ofs.write(byte_table.data(), byte_table.size());
+
+    LOG_S(INFO) << "wrote cmap-table with " << cmap_table.size() << " cmaps, "
+                << range_table.size()/RANGE_SIZE << " ranges and "
+                << cid_table.size()/CID_SIZE << " cids to " << filename;
+
+    return ofs.good();
+  }
+
+}
+
+#endif
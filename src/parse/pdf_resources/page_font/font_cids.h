@@ -5,11 +5,18 @@
 
 #include <fstream>
 
+#include <atomic>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace pdflib
 {
 
+  // Registry of the Adobe cmap-resources. The cmaps are looked up in the
+  // compiled table (cmap-resources.bin, see font_cid_table) if present, and
+  // otherwise parsed from the text files. The resources are shared by all
+  // parsers in the process, so both paths are safe to use from concurrent
+  // page decoders.
   class font_cids
   {
 
@@ -20,19 +27,31 @@ namespace pdflib
 
     void initialise(std::string dirname);
 
-    bool      has(std::string font_name);
-    font_cid& get(std::string encoding_name);
+    bool has(std::string font_name);
+
+    // returns nullptr for unknown cmap-names
+    std::shared_ptr<const font_cid> get(std::string cmap_name);
 
     int get_supplement(std::string registry, 
 		       std::string ordering);
 
-    bool decode_cmap_resource(std::string font_name);
-
     void decode_all();
 
+    // compile all cmaps into a binary table (see font_cid_table)
+    bool compile(std::string filename);
+
+  private:
+
+    std::shared_ptr<const font_cid> decode_cmap_resource(std::string cmap_name);
+
+    // returns nullptr if the cmap was not unpacked or parsed yet
+    std::shared_ptr<const font_cid> find_cid(const std::string& cmap_name);
+
   private:
 
-    bool initialized;
+    std::mutex init_mutex;
+    std::atomic<bool> initialized;
+
     std::string directory;
 
     std::unordered_map<std::string, int>                       ro_2_sup;
@@ -42,7 +61,13 @@ namespace pdflib
     std::unordered_map<std::string, std::string> cmap_2_cid2code;
     std::unordered_map<std::string, std::vector<std::string> > cmap_2_columns;
 
-    std::unordered_map<std::string, font_cid> cids;
+    // immutable after initialise, so it is read without locking
+    font_cid_table table;
+
+    // cmaps unpacked from the table or parsed from the text files. Once a
+    // cmap is cached, lookups only take the lock shared.
+    std::shared_mutex cids_mutex;
+    std::unordered_map<std::string, std::shared_ptr<const font_cid> > cids;
   };
 
   font_cids::font_cids():
@@ -57,12 +82,38 @@ namespace pdflib
     //LOG_S(INFO) << __FUNCTION__ << ": " << font_name << "\t" 
     //<< cmap_2_filename.count(font_name);
 
-    return (cmap_2_filename.count(font_name)==1);
+    return (cmap_2_filename.count(font_name)==1 or table.has(font_name));
   }
 
-  font_cid& font_cids::get(std::string encoding_name)
+  std::shared_ptr<const font_cid> font_cids::get(std::string cmap_name)
   {
-    return cids[encoding_name];
+    auto cached = find_cid(cmap_name);
+    if(cached!=nullptr)
+      {
+	return cached;
+      }
+
+    if(table.has(cmap_name))
+      {
+	// unpacked once, as the cmaps parsed from the text files. The table
+	// is read-only, so concurrent decoders may unpack the same cmap, but
+	// only the first one is kept.
+	auto cid = std::make_shared<font_cid>();
+	table.decode(cmap_name, *cid);
+
+	std::unique_lock<std::shared_mutex> lock(cids_mutex);
+	return cids.emplace(cmap_name, cid).first->second;
+      }
+
+    return decode_cmap_resource(cmap_name);
+  }
+
+  std::shared_ptr<const font_cid> font_cids::find_cid(const std::string& cmap_name)
+  {
+    std::shared_lock<std::shared_mutex> lock(cids_mutex);
+
+    auto itr = cids.find(cmap_name);
+    return (itr!=cids.end())? itr->second : nullptr;
   }
 
   int font_cids::get_supplement(std::string registry, 
@@ -85,6 +136,8 @@ namespace pdflib
 
   void font_cids::initialise(std::string dirname)
   {
+    std::lock_guard<std::mutex> lock(init_mutex);
+
     if(initialized)
       {
 	LOG_S(WARNING) << "skipping font_cids::initialise, already initialized ...";
@@ -134,36 +187,45 @@ namespace pdflib
 	  }
       }
 
+    // the compiled table lives next to the directory: cmap-resources.bin
+    {
+      std::string filename = directory.substr(0, directory.size()-1)+".bin";
+      table.load(filename);
+    }
+
     initialized = true;
   }
 
-  bool font_cids::decode_cmap_resource(std::string cmap_name)
+  std::shared_ptr<const font_cid> font_cids::decode_cmap_resource(std::string cmap_name)
   {
     LOG_S(INFO) << __FUNCTION__;    
 
-    // fetch pre-cached cid-fonts
-    if(cids.count(cmap_name)==1)
+    if(cmap_2_cid2code.count(cmap_name)==0)
       {
-	//cid = cids[cmap_name];
-	return true;
+	LOG_S(INFO) << "unknown cmap-name: " << cmap_name;    	
+	return nullptr;
       }
-    else if(cmap_2_cid2code.count(cmap_name)==1)
-      {
-	std::vector<std::string> columns = cmap_2_columns[cmap_name];
-	std::string cid2code = cmap_2_cid2code[cmap_name];
-	std::string filename = cmap_2_filename[cmap_name];
-	
-	font_cid& cid = cids[cmap_name];
-	cid.decode_cmap_resource(filename, cid2code, columns);
 
-	//cids[cmap_name] = cid;
-	return true;
-      }
-    else
+    // the lock is held while parsing, so concurrent decoders of the same
+    // cmap wait for the first one instead of parsing it again
+    std::unique_lock<std::shared_mutex> lock(cids_mutex);
+
+    // fetch pre-cached cid-fonts
+    auto itr = cids.find(cmap_name);
+    if(itr!=cids.end())
       {
-	LOG_S(INFO) << "unknown cmap-name: " << cmap_name;    	
-	return false;
+	return itr->second;
       }
+
+    std::vector<std::string> columns = cmap_2_columns.at(cmap_name);
+    std::string cid2code = cmap_2_cid2code.at(cmap_name);
+    std::string filename = cmap_2_filename.at(cmap_name);
+	
+    auto cid = std::make_shared<font_cid>();
+    cid->decode_cmap_resource(filename, cid2code, columns);
+
+    cids.emplace(cmap_name, cid);
+    return cid;
   }
 
   void font_cids::decode_all()
@@ -187,6 +249,36 @@ namespace pdflib
       }
   }
 
+  bool font_cids::compile(std::string filename)
+  {
+    LOG_S(INFO) << __FUNCTION__ << ": " << filename;
+
+    font_cid_table compiled_table;
+
+    // the cid2code.txt is shared by all cmaps of a collection, so it is
+    // only parsed once
+    for(auto itr=ros_2_cols.begin(); itr!=ros_2_cols.end(); itr++)
+      {
+	font_cid collection;
+	collection.read_cid2code(directory+(itr->first)+"/cid2code.txt", itr->second);
+
+	compiled_table.add_collection(itr->first, collection.get_cid2utf8());
+
+	std::string cdir = directory+(itr->first)+"/CMap";
+
+	std::vector<std::string> files = utils::filesystem::list_files(cdir, true);
+	for(auto file:files)
+	  {
+	    font_cid cmap;
+	    cmap.read_cmap2cid(cdir+"/"+file);
+
+	    compiled_table.add_cmap(file, itr->first, cmap.get_cmap2cid());
+	  }
+      }
+
+    return compiled_table.write(filename);
+  }
+
 }
 
 #endif
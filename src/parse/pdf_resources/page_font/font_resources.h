@@ -0,0 +1,161 @@
+//-*-C++-*-
+
+#ifndef PDF_PAGE_FONT_RESOURCES_H
+#define PDF_PAGE_FONT_RESOURCES_H
+
+namespace pdflib
+{
+
+  // Compiled form of the glyph-lists, encodings and base-font metrics (see
+  // app/compile_resources.cpp), so that initialising the font resources
+  // does not have to parse the text files. The file is memory-mapped and
+  // has a section per resource:
+  //
+  //   magic, version, glyphs, encodings, base-fonts
+  //
+  // where each section is a length-prefixed blob (see utils::binary).
+  class font_resources
+  {
+    const static uint32_t MAGIC   = 0x52465044; // "DPFR"
+    const static uint32_t VERSION = 1;
+
+  public:
+
+    font_resources();
+    ~font_resources();
+
+    bool load(std::string filename);
+
+    bool is_loaded() const;
+
+    utils::binary::reader get_glyphs() const;
+    utils::binary::reader get_encodings() const;
+    utils::binary::reader get_base_fonts() const;
+
+    static bool write(std::string     filename,
+                      font_glyphs&    glyphs,
+                      font_encodings& encodings,
+                      base_fonts&     bfonts);
+
+  private:
+
+    utils::filesystem::mapped_file file;
+
+    utils::binary::reader glyphs;
+    utils::binary::reader encodings;
+    utils::binary::reader bfonts;
+  };
+
+  font_resources::font_resources()
+  {}
+
+  font_resources::~font_resources()
+  {}
+
+  bool font_resources::load(std::string filename)
+  {
+    if(is_loaded())
+      {
+        return true;
+      }
+
+    if(not file.open(filename))
+      {
+        LOG_S(INFO) << "no compiled font-resources at " << filename;
+        return false;
+      }
+
+    try
+      {
+        utils::binary::reader reader(file.data(), file.size());
+
+        if(reader.read_uint32()!=MAGIC or reader.read_uint32()!=VERSION)
+          {
+            LOG_S(WARNING) << "ignoring incompatible font-resources at " << filename;
+
+            file.close();
+            return false;
+          }
+
+        glyphs    = reader.read_blob();
+        encodings = reader.read_blob();
+        bfonts    = reader.read_blob();
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(WARNING) << "ignoring truncated font-resources at " << filename;
+
+        glyphs    = utils::binary::reader();
+        encodings = utils::binary::reader();
+        bfonts    = utils::binary::reader();
+
+        file.close();
+        return false;
+      }
+
+    LOG_S(INFO) << "loaded compiled font-resources from " << filename;
+
+    return true;
+  }
+
+  bool font_resources::is_loaded() const
+  {
+    return (bfonts.data()!=NULL);
+  }
+
+  utils::binary::reader font_resources::get_glyphs() const
+  {
+    return glyphs;
+  }
+
+  utils::binary::reader font_resources::get_encodings() const
+  {
+    return encodings;
+  }
+
+  utils::binary::reader font_resources::get_base_fonts() const
+  {
+    return bfonts;
+  }
+
+  bool font_resources::write(std::string     filename,
+                             font_glyphs&    glyphs,
+                             font_encodings& encodings,
+                             base_fonts&     bfonts)
+  {
+    LOG_S(INFO) << __FUNCTION__ << ": " << filename;
+
+    utils::binary::writer glyphs_writer;
+    glyphs.write(glyphs_writer);
+
+    utils::binary::writer encodings_writer;
+    encodings.write(encodings_writer);
+
+    utils::binary::writer bfonts_writer;
+    bfonts.write(bfonts_writer);
+
+    utils::binary::writer writer;
+    {
+      writer.write_uint32(MAGIC);
+      writer.write_uint32(VERSION);
+
+      writer.write_string(glyphs_writer.get());
+      writer.write_string(encodings_writer.get());
+      writer.write_string(bfonts_writer.get());
+    }
+
+    std::ofstream ofs(filename, std::ios::binary);
+    if(not ofs)
+      {
+        LOG_S(ERROR) << "could not write font-resources to " << filename;
+        return false;
+      }
+
+    ofs.write(writer.get().data(), writer.get().size());
+
+    return ofs.good();
+  }
+
+}
+
+#endif
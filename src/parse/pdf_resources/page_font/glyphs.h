@@ -28,6 +28,10 @@ namespace pdflib
     std::string operator[](std::string key);
 
     void initialise(std::string dirname);
+
+    // initialise from / write to the compiled font-resources (see font_resources)
+    void initialise(utils::binary::reader reader);
+    void write(utils::binary::writer& writer);
     
   private:
 
@@ -41,6 +45,8 @@ namespace pdflib
 
     bool initialized;
     
+    // glyphs are looked up from concurrently decoded pages
+    std::mutex unknown_mutex;
     std::unordered_set<std::string> unknown_glyphs;
 
     std::unordered_map<std::string, std::string> name_to_code;
@@ -95,11 +101,15 @@ namespace pdflib
 
   std::string font_glyphs::operator[](std::string key)
   {
-    if(name_to_utf8.count(key)==1)
-      return name_to_utf8[key];
+    auto itr = name_to_utf8.find(key);
+    if(itr!=name_to_utf8.end())
+      return itr->second;
 
     LOG_S(ERROR) << "could not find a glyph with name=" << key;
-    unknown_glyphs.insert(key);
+    {
+      std::lock_guard<std::mutex> lock(unknown_mutex);
+      unknown_glyphs.insert(key);
+    }
 
     return "glyph["+key+"]";
   }
@@ -146,6 +156,48 @@ namespace pdflib
     initialized = true;
   }
 
+  void font_glyphs::initialise(utils::binary::reader reader)
+  {
+    if(initialized)
+      {
+	LOG_S(WARNING) << "skipping font_glyphs::initialise, already initialized ...";
+	return;
+      }
+
+    LOG_S(INFO) << "font-glyphs initialise from compiled resources";
+
+    uint32_t num_glyphs = reader.read_uint32();
+
+    name_to_code.reserve(num_glyphs);
+    name_to_utf8.reserve(num_glyphs);
+
+    for(uint32_t l=0; l<num_glyphs; l++)
+      {
+        std::string key  = reader.read_string();
+        std::string code = reader.read_string();
+        std::string utf8 = reader.read_string();
+
+        name_to_code.emplace(key, code);
+        name_to_utf8.emplace(key, utf8);
+      }
+
+    initialized = true;
+  }
+
+  void font_glyphs::write(utils::binary::writer& writer)
+  {
+    writer.write_uint32(name_to_utf8.size());
+
+    for(auto itr=name_to_utf8.begin(); itr!=name_to_utf8.end(); itr++)
+      {
+        auto code = name_to_code.find(itr->first);
+
+        writer.write_string(itr->first);
+        writer.write_string(code!=name_to_code.end()? code->second : "");
+        writer.write_string(itr->second);
+      }
+  }
+
   void font_glyphs::read_file_hex(std::string filename)
   {
     LOG_S(INFO) << __FUNCTION__ << ": " << filename;
@@ -15,6 +15,7 @@ namespace pdflib
     pdf_resource(std::shared_ptr<pdf_resource<PAGE_FONTS>> parent);
     ~pdf_resource();
 
+    // json of the fonts that have been decoded so far
     nlohmann::json get();
 
     size_t size();
@@ -23,23 +24,61 @@ namespace pdflib
 
     std::unordered_set<std::string> keys();
 
-    pdf_resource<PAGE_FONT>& operator[](std::string fort_name);
+    // Decodes the font on first access (see resolve).
+    const pdf_resource<PAGE_FONT>& operator[](std::string fort_name);
 
+    // Decode the font if it is still unresolved. A font that fails to
+    // decode is dropped (count(font_name) becomes 0) and false is returned.
+    bool resolve(std::string font_name);
+
+    // Share decoded fonts through a document-wide cache. Children created
+    // from this resource (form xobjects, appearance streams) inherit it.
+    void set_font_cache(std::shared_ptr<pdf_resource<DOCUMENT_FONTS>> font_cache,
+                        bool extract_font_programs);
+
+    // Registers the fonts of a /Font dictionary. Fonts are only decoded
+    // when they are first selected (Tf), so unused entries cost nothing.
     void set(QPDFObjectHandle& qpdf_fonts_,
              pdf_timings& timings);
 
+  private:
+
+    std::shared_ptr<const pdf_resource<PAGE_FONT>> decode_font(std::string const& key,
+                                                               QPDFObjectHandle qpdf_font,
+                                                               pdf_timings& timings);
+
+    std::shared_ptr<const pdf_resource<PAGE_FONT>> load_font(std::string const& key,
+                                                             QPDFObjectHandle qpdf_font,
+                                                             pdf_timings& timings);
+
   private:
 
     std::shared_ptr<pdf_resource<PAGE_FONTS>> parent_;
-    std::unordered_map<std::string, pdf_resource<PAGE_FONT> > page_fonts;
+    std::unordered_map<std::string, std::shared_ptr<const pdf_resource<PAGE_FONT> > > page_fonts;
+
+    // registered but not yet decoded fonts
+    std::unordered_map<std::string, QPDFObjectHandle> unresolved_fonts;
+
+    // timings of the page that registered the fonts (outlives this resource
+    // while the page is being decoded)
+    pdf_timings* timings_;
+
+    std::shared_ptr<pdf_resource<DOCUMENT_FONTS>> font_cache_;
+    bool extract_font_programs_;
   };
 
   pdf_resource<PAGE_FONTS>::pdf_resource():
-    parent_(nullptr)
+    parent_(nullptr),
+    timings_(nullptr),
+    font_cache_(nullptr),
+    extract_font_programs_(false)
   {}
 
   pdf_resource<PAGE_FONTS>::pdf_resource(std::shared_ptr<pdf_resource<PAGE_FONTS>> parent):
-    parent_(parent)
+    parent_(parent),
+    timings_(nullptr),
+    font_cache_(parent ? parent->font_cache_ : nullptr),
+    extract_font_programs_(parent ? parent->extract_font_programs_ : false)
   {}
 
   pdf_resource<PAGE_FONTS>::~pdf_resource()
@@ -51,21 +90,21 @@ namespace pdflib
     {
       for(auto itr=page_fonts.begin(); itr!=page_fonts.end(); itr++)
         {
-          result[itr->first] = (itr->second).get();
+          result[itr->first] = (itr->second)->get();
         }
     }
-    
+
     return result;
   }
 
   size_t pdf_resource<PAGE_FONTS>::size()
   {
-    return page_fonts.size();
+    return page_fonts.size() + unresolved_fonts.size();
   }
 
   int pdf_resource<PAGE_FONTS>::count(std::string key)
   {
-    if(page_fonts.count(key)==1)
+    if(page_fonts.count(key)==1 or unresolved_fonts.count(key)==1)
       {
         return 1;
       }
@@ -90,14 +129,71 @@ namespace pdflib
         keys_.insert(itr->first);
       }
 
+    for(auto itr=unresolved_fonts.begin(); itr!=unresolved_fonts.end(); itr++)
+      {
+        keys_.insert(itr->first);
+      }
+
     return keys_;
   }
 
-  pdf_resource<PAGE_FONT>& pdf_resource<PAGE_FONTS>::operator[](std::string font_name)
+  bool pdf_resource<PAGE_FONTS>::resolve(std::string font_name)
+  {
+    if(page_fonts.count(font_name)==1)
+      {
+        return true;
+      }
+
+    auto itr = unresolved_fonts.find(font_name);
+    if(itr == unresolved_fonts.end())
+      {
+        if(parent_)
+          {
+            return parent_->resolve(font_name);
+          }
+        return false;
+      }
+
+    QPDFObjectHandle qpdf_font = itr->second;
+    unresolved_fonts.erase(itr);
+
+    LOG_S(INFO) << "decoding font: " << font_name;
+
+    pdf_timings local_timings;
+    pdf_timings& timings = (timings_ != nullptr) ? *timings_ : local_timings;
+
+    utils::timer font_timer;
+
+    bool success = true;
+    try
+      {
+        page_fonts.emplace(font_name, load_font(font_name, qpdf_font, timings));
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(ERROR) << "could not decode font " << font_name << ": " << exc.what();
+        success = false;
+      }
+
+    // fonts are resolved while the content stream is interpreted, so the
+    // time is attributed to decode_fonts_total instead of the operators
+    double font_time = font_timer.get_time();
+    timings.add_timing(pdf_timings::KEY_DECODE_FONTS_TOTAL, font_time);
+    timings.note_attributed(font_time);
+
+    return success;
+  }
+
+  const pdf_resource<PAGE_FONT>& pdf_resource<PAGE_FONTS>::operator[](std::string font_name)
   {
+    if(unresolved_fonts.count(font_name)==1)
+      {
+        resolve(font_name);
+      }
+
     if(page_fonts.count(font_name)==1)
       {
-        return page_fonts.at(font_name);
+        return *page_fonts.at(font_name);
       }
 
     if(parent_)
@@ -123,44 +219,103 @@ namespace pdflib
       throw std::logic_error(ss.str());
     }
 
-    return (page_fonts.begin()->second);
+    return *(page_fonts.begin()->second);
+  }
+
+  void pdf_resource<PAGE_FONTS>::set_font_cache(std::shared_ptr<pdf_resource<DOCUMENT_FONTS>> font_cache,
+                                                bool extract_font_programs)
+  {
+    font_cache_ = font_cache;
+    extract_font_programs_ = extract_font_programs;
+  }
+
+  std::shared_ptr<const pdf_resource<PAGE_FONT>>
+  pdf_resource<PAGE_FONTS>::decode_font(std::string const& key,
+                                        QPDFObjectHandle qpdf_font,
+                                        pdf_timings& timings)
+  {
+    nlohmann::json json_font = to_json(qpdf_font);
+
+    LOG_S(INFO) << json_font.dump(2);
+
+    auto page_font = std::make_shared<pdf_resource<PAGE_FONT>>();
+    page_font->set(key, json_font, qpdf_font, timings);
+
+    return page_font;
+  }
+
+  std::shared_ptr<const pdf_resource<PAGE_FONT>>
+  pdf_resource<PAGE_FONTS>::load_font(std::string const& key,
+                                      QPDFObjectHandle qpdf_font,
+                                      pdf_timings& timings)
+  {
+    // Fonts are cached by (object-id, resource-name): the resource name
+    // ends up in the cells (font_key), so the same font dictionary used
+    // under another name is decoded again.
+    if(not font_cache_ or not qpdf_font.isIndirect())
+      {
+        return decode_font(key, qpdf_font, timings);
+      }
+
+    QPDFObjGen og = qpdf_font.getObjGen();
+
+    utils::timer cache_timer;
+    auto page_font = font_cache_->find(og, key, extract_font_programs_);
+
+    if(page_font)
+      {
+        timings.add_timing(pdf_timings::KEY_FONT_CACHE_HIT, cache_timer.get_time());
+        return page_font;
+      }
+
+    auto decoded_font = decode_font(key, qpdf_font, timings);
+
+    // A cached font is used by pages decoded on other threads (and other
+    // QPDF documents), so nothing may be left to extract lazily from this
+    // decoder's QPDF objects: the program is either extracted now, or
+    // disabled for good (such fonts are cached apart, see find).
+    if(extract_font_programs_)
+      {
+        decoded_font->get_embedded_font_blob();
+      }
+    else
+      {
+        decoded_font->disable_embedded_font_blob();
+      }
+
+    cache_timer.reset();
+    page_font = font_cache_->insert(og, key, extract_font_programs_, decoded_font);
+
+    timings.add_timing(pdf_timings::KEY_FONT_CACHE_MISS, cache_timer.get_time());
+
+    return page_font;
   }
-  
+
   void pdf_resource<PAGE_FONTS>::set(QPDFObjectHandle& qpdf_fonts,
                                      pdf_timings& timings)
   {
     LOG_S(INFO) << __FUNCTION__;
 
-    double total_font_time = 0.0;
+    timings_ = &timings;
+
+    utils::timer font_timer;
 
     for(auto& key : qpdf_fonts.getKeys())
       {
-        LOG_S(INFO) << "decoding font: " << key;
-
-	utils::timer font_timer;
+        LOG_S(INFO) << "registering font: " << key;
 
-	QPDFObjectHandle qpdf_font = qpdf_fonts.getKey(key);
-	nlohmann::json json_font = to_json(qpdf_font);
-
-	LOG_S(INFO) << json_font.dump(2);
-	
-	pdf_resource<PAGE_FONT> page_font(timings);
-	page_font.set(key, json_font, qpdf_font);
-
-	if(page_fonts.count(key)==1)
+	if(page_fonts.count(key)==1 or unresolved_fonts.count(key)==1)
 	  {
 	    LOG_S(WARNING) << "We are overwriting a font!";
 	    page_fonts.erase(key);
+	    unresolved_fonts.erase(key);
 	  }
 
-	page_fonts.emplace(key, std::move(page_font));
-
-	double font_time = font_timer.get_time();
-	total_font_time += font_time;
-	// per-font (dynamic) timing disabled for now; only the total is reported
-	//timings.add_timing(pdf_timings::PREFIX_DECODE_FONT + key, font_time);
+	unresolved_fonts.emplace(key, qpdf_fonts.getKey(key));
       }
 
+    double total_font_time = font_timer.get_time();
+
     timings.add_timing(pdf_timings::KEY_DECODE_FONTS_TOTAL, total_font_time);
     timings.note_attributed(total_font_time);
   }
@@ -42,6 +42,9 @@ namespace pdflib
     QPDFObjectHandle get_colorspaces() const;
     QPDFObjectHandle get_xobjects() const;
 
+    // content-stream of the form
+    QPDFObjectHandle get_stream() const;
+
     std::vector<qpdf_stream_instruction> parse_stream() const;
 
   private:
@@ -191,6 +194,11 @@ namespace pdflib
     return QPDFObjectHandle::newNull();
   }
 
+  QPDFObjectHandle pdf_resource<PAGE_XOBJECT_FORM>::get_stream() const
+  {
+    return qpdf_xobject;
+  }
+
   std::vector<qpdf_stream_instruction> pdf_resource<PAGE_XOBJECT_FORM>::parse_stream() const
   {
     std::vector<qpdf_stream_instruction> stream;
@@ -177,6 +177,9 @@ namespace pdflib
     bool                     has_jbig2_globals_data() const;
     std::shared_ptr<Buffer>  get_jbig2_globals_data() const;
 
+    // The stream data and the soft-mask are only fetched (and decoded) from
+    // the QPDF stream on first access, so images that are never drawn do not
+    // pay for the decompression.
     bool                     has_raw_stream_data() const;
     std::shared_ptr<Buffer>  get_raw_stream_data() const;
 
@@ -202,8 +205,8 @@ namespace pdflib
 
     void init_filters();
 
-    void init_stream_data();
-    void init_soft_mask_data();
+    void load_stream_data() const;
+    void load_soft_mask_data() const;
 
   private:
 
@@ -232,10 +235,15 @@ namespace pdflib
     std::string      intent;
     std::vector<std::string> image_filters;
 
-    // Stream data
-    std::shared_ptr<Buffer> raw_stream_data;
-    std::shared_ptr<Buffer> decoded_stream_data;
-    std::shared_ptr<std::vector<uint8_t>> soft_mask_data;
+    // Stream data (lazily loaded, see load_stream_data and load_soft_mask_data)
+    mutable std::mutex stream_data_mutex;
+
+    mutable bool stream_data_loaded = false;
+    mutable bool soft_mask_data_loaded = false;
+
+    mutable std::shared_ptr<Buffer> raw_stream_data;
+    mutable std::shared_ptr<Buffer> decoded_stream_data;
+    mutable std::shared_ptr<std::vector<uint8_t>> soft_mask_data;
 
     // PDF image semantics
     std::vector<double> decode_array; // length 2*ncomp when present
@@ -309,8 +317,6 @@ namespace pdflib
 
     init_filters();
     init_image_properties();
-    init_stream_data();
-    init_soft_mask_data();
   }
 
   void pdf_resource<PAGE_XOBJECT_IMAGE>::init_image_properties()
@@ -901,9 +907,15 @@ namespace pdflib
       }
   }
 
-  void pdf_resource<PAGE_XOBJECT_IMAGE>::init_stream_data()
+  void pdf_resource<PAGE_XOBJECT_IMAGE>::load_stream_data() const
   {
-    LOG_S(INFO) << __FUNCTION__;
+    if(stream_data_loaded)
+      {
+        return;
+      }
+    stream_data_loaded = true;
+
+    LOG_S(INFO) << __FUNCTION__ << " for xobject_key=" << xobject_key;
 
     if(not qpdf_xobject.isStream())
       {
@@ -934,8 +946,14 @@ namespace pdflib
       }
   }
 
-  void pdf_resource<PAGE_XOBJECT_IMAGE>::init_soft_mask_data()
+  void pdf_resource<PAGE_XOBJECT_IMAGE>::load_soft_mask_data() const
   {
+    if(soft_mask_data_loaded)
+      {
+        return;
+      }
+    soft_mask_data_loaded = true;
+
     soft_mask_data.reset();
 
     if(not qpdf_xobject_dict.hasKey("/SMask"))
@@ -1152,31 +1170,43 @@ namespace pdflib
 
   bool pdf_resource<PAGE_XOBJECT_IMAGE>::has_raw_stream_data() const
   {
-    return (raw_stream_data != nullptr && raw_stream_data->getSize() > 0);
+    auto data = get_raw_stream_data();
+    return (data != nullptr && data->getSize() > 0);
   }
 
   std::shared_ptr<Buffer> pdf_resource<PAGE_XOBJECT_IMAGE>::get_raw_stream_data() const
   {
+    std::lock_guard<std::mutex> lock(stream_data_mutex);
+
+    load_stream_data();
     return raw_stream_data;
   }
 
   bool pdf_resource<PAGE_XOBJECT_IMAGE>::has_decoded_stream_data() const
   {
-    return (decoded_stream_data != nullptr && decoded_stream_data->getSize() > 0);
+    auto data = get_decoded_stream_data();
+    return (data != nullptr && data->getSize() > 0);
   }
 
   std::shared_ptr<Buffer> pdf_resource<PAGE_XOBJECT_IMAGE>::get_decoded_stream_data() const
   {
+    std::lock_guard<std::mutex> lock(stream_data_mutex);
+
+    load_stream_data();
     return decoded_stream_data;
   }
 
   bool pdf_resource<PAGE_XOBJECT_IMAGE>::has_soft_mask_data() const
   {
-    return (soft_mask_data != nullptr and not soft_mask_data->empty());
+    auto data = get_soft_mask_data();
+    return (data != nullptr and not data->empty());
   }
 
   std::shared_ptr<std::vector<uint8_t>> pdf_resource<PAGE_XOBJECT_IMAGE>::get_soft_mask_data() const
   {
+    std::lock_guard<std::mutex> lock(stream_data_mutex);
+
+    load_soft_mask_data();
     return soft_mask_data;
   }
 
@@ -1226,7 +1256,10 @@ namespace pdflib
 
   void pdf_resource<PAGE_XOBJECT_IMAGE>::save_to_file(std::filesystem::path const& path) const
   {
-    if(not has_raw_stream_data())
+    auto raw_stream_data     = get_raw_stream_data();
+    auto decoded_stream_data = get_decoded_stream_data();
+
+    if(not (raw_stream_data and raw_stream_data->getSize() > 0))
       {
         LOG_S(WARNING) << "no raw stream data to save";
         return;
@@ -1297,7 +1330,8 @@ namespace pdflib
         LOG_S(WARNING) << "JPEG correction failed, falling back to raw copy: " << path.string();
       }
 
-    if(is_jpeg_ext and (not filters_have_dct) and has_decoded_stream_data())
+    if(is_jpeg_ext and (not filters_have_dct)
+       and decoded_stream_data and decoded_stream_data->getSize() > 0)
       {
         // Raw pixels (e.g. /FlateDecode) — encode to JPEG from the decoded stream.
         // Future: for lossless export, encode to PNG here instead
@@ -46,6 +46,16 @@ namespace pdflib
     void add_bitmap_instruction(const page_item<PAGE_IMAGE>& image,
                                 clip_state_instruction clip_state);
 
+    // power-of-two reduction (1, 2, 4 or 8) at which the image still covers
+    // its device-space size for config.bitmap_decode_scale
+    int get_decode_reduction(const page_item<PAGE_IMAGE>& image) const;
+
+    // nearest-neighbor resampling of the soft-mask onto the decoded pixels
+    static std::shared_ptr<std::vector<uint8_t> > resample_alpha(
+      const std::shared_ptr<std::vector<uint8_t> >& alpha,
+      int src_width, int src_height,
+      int dst_width, int dst_height);
+
     bool get_clip_path_bbox(const clip_path_instruction& clip_path,
                             std::array<double, 4>& bbox) const;
 
@@ -147,6 +157,63 @@ namespace pdflib
     return true;
   }
 
+  int pdf_state<BITMAP>::get_decode_reduction(const page_item<PAGE_IMAGE>& image) const
+  {
+    if(config.bitmap_decode_scale <= 0.0 or
+       image.image_width <= 0 or image.image_height <= 0)
+      {
+        return 1;
+      }
+
+    // the image unit-square maps (0,0) -> r_0, (0,1) -> r_1 and (1,0) -> r_3
+    const double device_width  = config.bitmap_decode_scale*std::hypot(image.r_x3-image.r_x0,
+                                                                       image.r_y3-image.r_y0);
+    const double device_height = config.bitmap_decode_scale*std::hypot(image.r_x1-image.r_x0,
+                                                                       image.r_y1-image.r_y0);
+
+    if(not (std::isfinite(device_width) and std::isfinite(device_height)))
+      {
+        return 1;
+      }
+
+    int reduction = 1;
+    while(reduction < 8 and
+          image.image_width  >= 2*reduction*device_width and
+          image.image_height >= 2*reduction*device_height)
+      {
+        reduction *= 2;
+      }
+
+    return reduction;
+  }
+
+  std::shared_ptr<std::vector<uint8_t> > pdf_state<BITMAP>::resample_alpha(
+    const std::shared_ptr<std::vector<uint8_t> >& alpha,
+    int src_width, int src_height,
+    int dst_width, int dst_height)
+  {
+    if((not alpha) or
+       (src_width == dst_width and src_height == dst_height) or
+       src_width <= 0 or src_height <= 0 or dst_width <= 0 or dst_height <= 0 or
+       alpha->size() < static_cast<size_t>(src_width) * src_height)
+      {
+        return alpha;
+      }
+
+    auto result = std::make_shared<std::vector<uint8_t> >(static_cast<size_t>(dst_width) * dst_height);
+    for(int row = 0; row < dst_height; ++row)
+      {
+        const size_t src_row = (static_cast<size_t>(row) * src_height) / dst_height;
+        for(int col = 0; col < dst_width; ++col)
+          {
+            const size_t src_col = (static_cast<size_t>(col) * src_width) / dst_width;
+            (*result)[static_cast<size_t>(row) * dst_width + col] = (*alpha)[src_row * src_width + src_col];
+          }
+      }
+
+    return result;
+  }
+
   pdf_state<BITMAP>::visible_bbox_state pdf_state<BITMAP>::compute_visible_bbox(
     const page_item<PAGE_IMAGE>& image,
     const clip_state_instruction& clip_state,
@@ -729,6 +796,7 @@ namespace pdflib
             params.height      = image.image_height;
             params.decode      = image.decode_array;
             params.has_decode  = image.decode_present and not image.decode_array.empty();
+            params.scale_denom = get_decode_reduction(image);
 
             LOG_S(INFO) << "bitmap: JPEG fallback parameters"
                         << " xobject_key=" << image.xobject_key
@@ -736,6 +804,7 @@ namespace pdflib
                         << " icc_components=" << image.icc_components
                         << " requested_cs=" << jpeg::color_space_name(cs)
                         << " size=" << params.width << "x" << params.height
+                        << " scale=1/" << params.scale_denom
                         << " decode_len=" << params.decode.size();
 
             auto decoded = jpeg::decode_pdf_jpeg_stream_to_raw_pixels(
@@ -791,9 +860,21 @@ namespace pdflib
                         << "decoding JPEG2000 via OpenJPEG "
                         << "for xobject_key=" << image.xobject_key;
 
+            // a reduced decode filters the samples, which is meaningless
+            // for palette indices
+            int reduce = 0;
+            if(not (image.indexed_palette and not image.indexed_palette->empty()))
+              {
+                for(int reduction = get_decode_reduction(image); reduction > 1; reduction /= 2)
+                  {
+                    reduce += 1;
+                  }
+              }
+
             auto decoded = jpx::decode_jpx_to_raw_pixels(
                 reinterpret_cast<uint8_t const*>(image.raw_stream_data->getBuffer()),
-                static_cast<std::size_t>(image.raw_stream_data->getSize()));
+                static_cast<std::size_t>(image.raw_stream_data->getSize()),
+                reduce);
 
             if(not decoded.empty())
               {
@@ -1052,9 +1133,19 @@ namespace pdflib
           }
       }
 
+    // the soft-mask is on the image grid, which differs from the pixels
+    // after a reduced-resolution decode
+    std::shared_ptr<std::vector<uint8_t> > alpha_data = image.soft_mask_data;
+    if(get_decode_reduction(image) > 1)
+      {
+        alpha_data = resample_alpha(alpha_data,
+                                    image.image_width, image.image_height,
+                                    pixel_shape[1], pixel_shape[0]);
+      }
+
     bitmap_instruction binstr(image.xobject_key,
                               std::move(pixel_data),
-                              image.soft_mask_data,
+                              std::move(alpha_data),
                               cmyk_conv,
                               pixel_shape,
                               fmt,
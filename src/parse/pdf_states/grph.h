@@ -461,20 +461,18 @@ namespace pdflib
   {
     if(not verify(instructions, 2, __FUNCTION__) ) { return; }
  
-    QPDFObjectHandle arr = instructions[0].obj;
+    qpdf_stream_instruction& arr = instructions[0];
 
-    //if(not arr.isArray()) { LOG_S(ERROR) << "instructions[0].obj is not an array"; return; }
+    //if(not arr.is_array()) { LOG_S(ERROR) << "instructions[0] is not an array"; return; }
     
-    if(arr.isArray())
+    if(arr.is_array())
       {
-	for(int l=0; l<arr.getArrayNItems(); l++)
+	for(auto& item:arr.get_array_items())
 	  {
-	    QPDFObjectHandle item = arr.getArrayItem(l);
-	    
-	    //assert(item.isNumber());
-	    if(item.isNumber())
+	    //assert(item.is_number());
+	    if(item.is_number())
 	      {
-		double val = utils::numeric::locale_safe_numeric_value(item);
+		double val = item.to_double();
 		dash_array.push_back(val);
 	      }
 	    else
@@ -483,14 +481,14 @@ namespace pdflib
 	      }
 	  }
       }
-    else if(arr.isNull())
+    else if(arr.is_null())
       {
-	LOG_S(WARNING) << "instructions[0].obj is null, re-interpreting it as an empty array";
+	LOG_S(WARNING) << "instructions[0] is null, re-interpreting it as an empty array";
 	dash_array = {};
       }
     else
       {
-	LOG_S(ERROR) << "instructions[0].obj is not an array nor null, defualting to an empty array";
+	LOG_S(ERROR) << "instructions[0] is not an array nor null, defualting to an empty array";
 	dash_array = {};
       }
     
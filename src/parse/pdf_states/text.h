@@ -60,12 +60,12 @@ namespace pdflib
 
     void move_cursor(double tx, double ty);
 
-    std::vector<page_item<PAGE_CELL> > generate_cells(qpdf_stream_instruction instruction,
+    std::vector<page_item<PAGE_CELL> > generate_cells(qpdf_stream_instruction& instruction,
                                                       int              stack_size);
 
-    std::vector<std::pair<uint32_t, std::string> > analyse_string(qpdf_stream_instruction instruction);
+    std::vector<std::pair<uint32_t, std::string> > analyse_string(qpdf_stream_instruction& instruction);
 
-    void add_cell(pdf_resource<PAGE_FONT>& font,
+    void add_cell(const pdf_resource<PAGE_FONT>& font,
                   std::string text,  double width,
                   int glyph_code,
                   int stack_size,
@@ -286,6 +286,13 @@ namespace pdflib
     font_name = instructions[0].to_utf8_string();
     font_size = instructions[1].to_double();
 
+    // fonts are decoded on first selection; a font that fails to decode
+    // is dropped and handled like an unknown font below
+    if(page_fonts->count(font_name) == 1)
+      {
+        page_fonts->resolve(font_name);
+      }
+
     if(page_fonts->count(font_name) == 0)
       {
         LOG_S(ERROR) << "unknown page-font: '" << font_name << "'";
@@ -329,12 +336,10 @@ namespace pdflib
 
     instr_count += 1;
 
-    for(auto item : instructions[0].obj.getArrayAsVector())
+    for(auto& item : instructions[0].get_array_items())
       {
-        if(item.isString())
+        if(item.type==TOKEN_STRING)
           {
-            qpdf_stream_instruction inst(item);
-
             std::vector<page_item<PAGE_CELL> > cells = generate_cells(item,
                                                                       stack_size);
 
@@ -343,9 +348,9 @@ namespace pdflib
                 page_cells.push_back(cell);
               }
           }
-        else if(item.isNumber())
+        else if(item.is_number())
           {
-            double value = utils::numeric::locale_safe_numeric_value(item);
+            double value = item.to_double();
 
             double tx = - value / 1000.0 * font_size * h_scaling;
             double ty = 0;
@@ -355,7 +360,7 @@ namespace pdflib
         else
           {
             LOG_S(ERROR) << "item is not a string nor a value: "
-                         << item.unparse() << " [" << item.getTypeName() << "]"
+                         << item.unparse() << " [" << item.key() << "]"
                          << " -> skipping for now ...";
           }
       }
@@ -367,7 +372,7 @@ namespace pdflib
     text_matrix[7] += tx * text_matrix[1] + ty * text_matrix[4];
   }
 
-  std::vector<page_item<PAGE_CELL> > pdf_state<TEXT>::generate_cells(qpdf_stream_instruction instruction,
+  std::vector<page_item<PAGE_CELL> > pdf_state<TEXT>::generate_cells(qpdf_stream_instruction& instruction,
                                                                      int              stack_size)
   {
     //LOG_S(INFO) << __FUNCTION__;
@@ -486,7 +491,7 @@ namespace pdflib
     return cells;
   }
 
-  void pdf_state<TEXT>::add_cell(pdf_resource<PAGE_FONT>& font,
+  void pdf_state<TEXT>::add_cell(const pdf_resource<PAGE_FONT>& font,
                                  std::string text, double width,
                                  int glyph_code,
                                  int stack_size,
@@ -632,12 +637,8 @@ namespace pdflib
 	
 	cell.space_width = space_width;
 	
-	cell.enc_name = font.get_encoding_name();
-	
-	cell.font_enc = to_string(font.get_encoding());
-	cell.font_key = font.get_key();
-	
-	cell.font_name = font.get_name();
+	// enc_name, font_enc, font_key and font_name
+	cell.set_font(font.get_cell_font());
 	cell.font_size = font_size/1000.0;
 	
 	cell.italic = false;
@@ -687,10 +688,10 @@ namespace pdflib
 	}
 	
         text_instruction tinstr(cell.text,
-                                cell.font_enc,
-                                cell.font_key,
-                                cell.font_name,
-                                cell.enc_name,
+                                cell.get_font_enc(),
+                                cell.get_font_key(),
+                                cell.get_font_name(),
+                                cell.get_enc_name(),
                                 font.get_base_font(),
                                 cell.font_size,
                                 glyph_rect.at(0), glyph_rect.at(1),
@@ -735,9 +736,9 @@ namespace pdflib
     move_cursor(width, 0);
   }
 
-  std::vector<std::pair<uint32_t, std::string> > pdf_state<TEXT>::analyse_string(qpdf_stream_instruction instruction)
+  std::vector<std::pair<uint32_t, std::string> > pdf_state<TEXT>::analyse_string(qpdf_stream_instruction& instruction)
   {
-    // LOG_S(INFO) << __FUNCTION__ << " fontname: " << font_name << ", key: " << instruction.key << " => val: " << instruction.val;
+    // LOG_S(INFO) << __FUNCTION__ << " fontname: " << font_name << ", key: " << instruction.key() << " => val: " << instruction.val();
 
     auto& font = (*page_fonts)[font_name];
 
@@ -326,26 +326,6 @@ namespace pdflib
     return toc;
   }
   
-  nlohmann::json extract_document_annotations_in_json(QPDF& pdf_obj,
-						      QPDFObjectHandle& root)
-  {
-    LOG_S(INFO) << __FUNCTION__;
-    
-    nlohmann::json annots = nlohmann::json::object({});
-
-    annots["form"] = extract_acroform_in_json(pdf_obj, root);
-    
-    annots["meta_xml"] = extract_metadata_in_json(pdf_obj, root);
-
-    annots["language"] = extract_language_in_json(pdf_obj, root);
-
-    annots["table_of_contents"] = extract_toc_in_json(pdf_obj, root);
-    
-    LOG_S(INFO) << "annotations: " << annots.dump(2);
-    
-    return annots;
-  }
-
 }
 
 #endif
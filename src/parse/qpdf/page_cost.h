@@ -0,0 +1,164 @@
+//-*-C++-*-
+
+#ifndef QPDF_PAGE_COST_H
+#define QPDF_PAGE_COST_H
+
+#include <set>
+
+#include <qpdf/QPDF.hh>
+
+namespace pdflib
+{
+  // Rough decode cost of a page, estimated from its dictionaries only: no
+  // stream is read or decompressed, so it is cheap enough to order all pages
+  // of a batch before decoding them. The unit is about one byte of content
+  // stream: the encoded lengths of the content streams and form xobjects,
+  // the encoded length plus a fraction of the pixels of the images and a
+  // fixed charge per font.
+  class page_cost
+  {
+  public:
+
+    constexpr static double FONT_COST        = 4096.0;
+    constexpr static double IMAGE_PIXEL_COST = 0.25;
+
+    constexpr static int MAX_FORM_DEPTH = 4;
+
+  public:
+
+    static double estimate(QPDFObjectHandle page);
+
+  private:
+
+    static double stream_length(QPDFObjectHandle obj);
+
+    static QPDFObjectHandle get_resources(QPDFObjectHandle page);
+
+    static double resources_cost(QPDFObjectHandle resources, int depth,
+                                 std::set<QPDFObjGen>& visited);
+  };
+
+  double page_cost::estimate(QPDFObjectHandle page)
+  {
+    if(not page.isDictionary())
+      {
+        return 0.0;
+      }
+
+    double cost = 0.0;
+
+    QPDFObjectHandle contents = page.getKey("/Contents");
+    if(contents.isArray())
+      {
+        for(auto& item : contents.getArrayAsVector())
+          {
+            cost += stream_length(item);
+          }
+      }
+    else
+      {
+        cost += stream_length(contents);
+      }
+
+    std::set<QPDFObjGen> visited;
+    cost += resources_cost(get_resources(page), 0, visited);
+
+    return cost;
+  }
+
+  double page_cost::stream_length(QPDFObjectHandle obj)
+  {
+    if(not obj.isStream())
+      {
+        return 0.0;
+      }
+
+    QPDFObjectHandle length = obj.getDict().getKey("/Length");
+    if(length.isInteger())
+      {
+        return std::max<double>(0.0, length.getIntValue());
+      }
+
+    return 0.0;
+  }
+
+  QPDFObjectHandle page_cost::get_resources(QPDFObjectHandle page)
+  {
+    // resources are inheritable, see decode_resources in pdf_decoder<PAGE>
+    for(int level = 0; level < 8 and page.isDictionary(); level++)
+      {
+        if(page.hasKey("/Resources"))
+          {
+            return page.getKey("/Resources");
+          }
+        page = page.getKey("/Parent");
+      }
+
+    return QPDFObjectHandle::newNull();
+  }
+
+  double page_cost::resources_cost(QPDFObjectHandle resources, int depth,
+                                   std::set<QPDFObjGen>& visited)
+  {
+    if(not resources.isDictionary())
+      {
+        return 0.0;
+      }
+
+    double cost = 0.0;
+
+    QPDFObjectHandle fonts = resources.getKey("/Font");
+    if(fonts.isDictionary())
+      {
+        cost += FONT_COST*fonts.getKeys().size();
+      }
+
+    QPDFObjectHandle xobjects = resources.getKey("/XObject");
+    if(not xobjects.isDictionary())
+      {
+        return cost;
+      }
+
+    for(auto& key : xobjects.getKeys())
+      {
+        QPDFObjectHandle xobject = xobjects.getKey(key);
+        if(not xobject.isStream())
+          {
+            continue;
+          }
+
+        // shared xobjects are decoded once per page (see xobject_parse_cache)
+        if(xobject.isIndirect() and (not visited.insert(xobject.getObjGen()).second))
+          {
+            continue;
+          }
+
+        QPDFObjectHandle dict = xobject.getDict();
+        QPDFObjectHandle subtype = dict.getKey("/Subtype");
+
+        cost += stream_length(xobject);
+
+        if(subtype.isName() and subtype.getName()=="/Image")
+          {
+            QPDFObjectHandle width = dict.getKey("/Width");
+            QPDFObjectHandle height = dict.getKey("/Height");
+
+            if(width.isInteger() and height.isInteger())
+              {
+                double pixels = std::max<double>(0.0, width.getIntValue())*
+                  std::max<double>(0.0, height.getIntValue());
+                cost += IMAGE_PIXEL_COST*pixels;
+              }
+          }
+        else if(subtype.isName() and subtype.getName()=="/Form" and depth < MAX_FORM_DEPTH)
+          {
+            cost += resources_cost(dict.getKey("/Resources"), depth+1, visited);
+          }
+      }
+
+    return cost;
+  }
+
+}
+
+#endif
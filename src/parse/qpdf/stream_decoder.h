@@ -29,6 +29,12 @@ namespace pdflib
 
     void handleEOF() override;
     
+  private:
+
+    // repair malformed numbers (e.g. "1.23-45") into real numbers
+    void repair_number(qpdf_stream_instruction& row,
+                       std::string const& val);
+
   private:
 
     std::vector<qpdf_stream_instruction>& stream;
@@ -54,7 +60,7 @@ namespace pdflib
   {
     for(auto row:stream)
       {
-        LOG_S(INFO) << std::setw(12) << row.key << " | " << row.val;
+        LOG_S(INFO) << std::setw(12) << row.key() << " | " << row.val();
       }
   }
 
@@ -76,104 +82,69 @@ namespace pdflib
     LOG_S(WARNING) << "finished decoding content-stream!";
   }
 
-  /*
-  void qpdf_stream_decoder::handleObject(QPDFObjectHandle obj)
-  {
-    LOG_S(INFO) << __FUNCTION__;
-
-    qpdf_stream_instruction row;
-    {
-      row.key = obj.getTypeName();
-      row.val = obj.unparse();
-      row.obj = obj;
-
-      //LOG_S(INFO) << std::setw(12) << row.key << " | " << row.val;
-    }
-
-    stream.push_back(row);
-  }
-  */
 
   void qpdf_stream_decoder::handleObject(QPDFObjectHandle obj, size_t offset, size_t len)
   {
     //LOG_S(INFO) << __FUNCTION__ << "\t offset: " << offset << ", len: " << len;
 
-    qpdf_stream_instruction row;
-    {
-      row.key = obj.getTypeName();
-      row.val = obj.unparse();
-      row.obj = obj;
-
-      // LOG_S(INFO) << std::setw(12) << row.key << " | " << row.val;
-    }
-
-    /*
-    if(row.is_null() or row.is_array() or row.is_dict())
-      {
-	LOG_S(WARNING) << "null: " << row.is_null() << ", array: " << row.is_array() << ", dict: " << row.is_dict();
-      }
-    */
+    // the token is typed once here (no type-name/unparse strings)
+    qpdf_stream_instruction row(obj, offset, len);
 
     // if the row is null, reinterprete it as an empty array. We encountered
     // this usecase for a parameter of the d operator (see Table 56) that is
     // null but in reality should be an empty array.
-    if(row.is_null())
+    if(row.type==TOKEN_NULL)
       {
-	row.key = "parameter";
-	row.val = "[]";
+	row.type = TOKEN_PARAMETER;
       }
     // All three regex patterns match malformed numbers containing '-' at
-    // position > 0 (e.g. "1.23-45", "--123.4").  Skip the expensive regex
-    // calls for the vast majority of tokens that don't have this.
-    else if (row.val.find('-', 1) != std::string::npos)
+    // position > 0 (e.g. "1.23-45", "--123.4"). QPDF hands those to us as
+    // (unknown) operators, so only those need to be looked at.
+    else if(row.type==TOKEN_OPERATOR and row.op==pdf_operator::null)
       {
-	std::smatch match;
+	std::string val = row.get_operator_name();
 
-	if (std::regex_match(row.val, match, value_pattern_0))
+	if(val.find('-', 1) != std::string::npos)
 	  {
-	    std::string mvalue = match[1].str();
-	    LOG_S(WARNING) << "match-1: " << std::setw(12) << row.key << " | " << row.val << " => new matched value: " << mvalue;
-
-	    double value = utils::numeric::locale_safe_stod(mvalue);
-
-	    // Creating a real (floating-point) QPDFObjectHandle
-	    QPDFObjectHandle new_obj = QPDFObjectHandle::newReal(value);
-
-	    row.key = new_obj.getTypeName();
-	    row.val = new_obj.unparse();
-	    row.obj = new_obj;
+	    repair_number(row, val);
 	  }
-	else if (std::regex_match(row.val, match, value_pattern_1))
-	  {
-	    std::string mvalue = match[1].str() + match[4].str();
-	    LOG_S(WARNING) << "match-2: " << std::setw(12) << row.key << " | " << row.val << " => new matched value: " << mvalue;
+      }
 
-	    double value = utils::numeric::locale_safe_stod(mvalue);
+    stream.push_back(row);
+  }
 
-	    // Creating a real (floating-point) QPDFObjectHandle
-	    QPDFObjectHandle new_obj = QPDFObjectHandle::newReal(value);
+  void qpdf_stream_decoder::repair_number(qpdf_stream_instruction& row,
+                                          std::string const& val)
+  {
+    std::smatch match;
 
-	    row.key = new_obj.getTypeName();
-	    row.val = new_obj.unparse();
-	    row.obj = new_obj;
-	  }
-	else if (std::regex_match(row.val, match, value_pattern_2))
-	  {
-	    std::string mvalue = match[3].str() + match[7].str();
-	    LOG_S(WARNING) << "match-3: " << std::setw(12) << row.key << " | " << row.val << " => new matched value: " << mvalue;
+    std::string mvalue = "";
+    if (std::regex_match(val, match, value_pattern_0))
+      {
+	mvalue = match[1].str();
+	LOG_S(WARNING) << "match-1: " << std::setw(12) << row.key() << " | " << val << " => new matched value: " << mvalue;
+      }
+    else if (std::regex_match(val, match, value_pattern_1))
+      {
+	mvalue = match[1].str() + match[4].str();
+	LOG_S(WARNING) << "match-2: " << std::setw(12) << row.key() << " | " << val << " => new matched value: " << mvalue;
+      }
+    else if (std::regex_match(val, match, value_pattern_2))
+      {
+	mvalue = match[3].str() + match[7].str();
+	LOG_S(WARNING) << "match-3: " << std::setw(12) << row.key() << " | " << val << " => new matched value: " << mvalue;
+      }
+    else
+      {
+	return;
+      }
 
-	    double value = utils::numeric::locale_safe_stod(mvalue);
+    double value = utils::numeric::locale_safe_stod(mvalue);
 
-	    // Creating a real (floating-point) QPDFObjectHandle
-	    QPDFObjectHandle new_obj = QPDFObjectHandle::newReal(value);
+    // Creating a real (floating-point) QPDFObjectHandle
+    QPDFObjectHandle new_obj = QPDFObjectHandle::newReal(value);
 
-	    row.key = new_obj.getTypeName();
-	    row.val = new_obj.unparse();
-	    row.obj = new_obj;
-	  }
-      }
-    
-    stream.push_back(row);
+    row = qpdf_stream_instruction(new_obj, row.offset, row.length);
   }
 
   void qpdf_stream_decoder::contentSize(size_t len)
@@ -6,17 +6,53 @@
 namespace pdflib
 {
 
+  // Type of a content-stream token. It is determined once, when the token
+  // is created, so the interpreters do not need to go through strings.
+  //
+  // Tokens produced by the native lexer (see stream_lexer.h) carry their
+  // value in the typed fields only (`obj` is not initialised); the QPDF
+  // object is then created on demand (see to_qpdf_object).
+  enum qpdf_token_type {
+    TOKEN_NULL,
+    TOKEN_BOOL,
+    TOKEN_INTEGER,
+    TOKEN_REAL,
+    TOKEN_NAME,
+    TOKEN_STRING,
+    TOKEN_ARRAY,
+    TOKEN_DICT,
+    TOKEN_OPERATOR,
+
+    // a null that is reinterpreted as an (empty) array parameter
+    TOKEN_PARAMETER,
+
+    TOKEN_OTHER
+  };
+
   class qpdf_stream_instruction
   {
   public:
 
     qpdf_stream_instruction();
     qpdf_stream_instruction(QPDFObjectHandle& obj_);
+    qpdf_stream_instruction(QPDFObjectHandle& obj_, size_t offset_, size_t length_);
 
     ~qpdf_stream_instruction();
 
+    // type-name and unparsed value, only needed for logging
+    std::string key();
+    std::string val();
+
     std::string unparse();
 
+    // true if the token was created from a QPDF object
+    bool has_obj();
+
+    // QPDF object of the token (created from the typed value if needed)
+    QPDFObjectHandle to_qpdf_object();
+
+    bool is_operator();
+
     bool is_integer();
     bool is_number();
     bool is_string();
@@ -24,7 +60,10 @@ namespace pdflib
     bool is_null();
     bool is_array();
     bool is_dict();
-        
+
+    // name of the operator (the operator enum is `null` for unknown ones)
+    std::string get_operator_name();
+
     int    to_int();
     double to_double();
 
@@ -32,126 +71,329 @@ namespace pdflib
     std::string to_char_string();
     std::string to_utf8_string();
 
+    // items of an array token
+    std::vector<qpdf_stream_instruction>& get_array_items();
+
+  private:
+
+    void set_type();
+
   public:
 
     QPDFObjectHandle obj;
 
-    std::string key="";
-    std::string val="";
+    qpdf_token_type type;
+    pdf_operator::operator_name op;
+
+    long long int_value;
+    double    num_value;
+
+    // decoded bytes of a name (with leading `/`), string or unknown
+    // operator of a native token (dictionaries are kept as text)
+    std::string str_value;
+
+    // items of an array token
+    std::vector<qpdf_stream_instruction> items;
+
+    // position of the token in the content-stream
+    size_t offset;
+    size_t length;
   };
 
-  qpdf_stream_instruction::qpdf_stream_instruction()
+  qpdf_stream_instruction::qpdf_stream_instruction():
+    type(TOKEN_NULL),
+    op(pdf_operator::null),
+    int_value(0),
+    num_value(0.0),
+    offset(0),
+    length(0)
   {}
 
   qpdf_stream_instruction::qpdf_stream_instruction(QPDFObjectHandle& obj_):
     obj(obj_),
-    key(obj_.getTypeName()),
-    val(obj_.unparse())
-  {}
+    type(TOKEN_NULL),
+    op(pdf_operator::null),
+    int_value(0),
+    num_value(0.0),
+    offset(0),
+    length(0)
+  {
+    set_type();
+  }
+
+  qpdf_stream_instruction::qpdf_stream_instruction(QPDFObjectHandle& obj_,
+                                                   size_t offset_, size_t length_):
+    obj(obj_),
+    type(TOKEN_NULL),
+    op(pdf_operator::null),
+    int_value(0),
+    num_value(0.0),
+    offset(offset_),
+    length(length_)
+  {
+    set_type();
+  }
 
   qpdf_stream_instruction::~qpdf_stream_instruction()
   {}
 
+  void qpdf_stream_instruction::set_type()
+  {
+    switch(obj.getTypeCode())
+      {
+      case ::ot_null: { type = TOKEN_NULL; } break;
+      case ::ot_boolean: { type = TOKEN_BOOL; } break;
+
+      case ::ot_integer:
+        {
+          type      = TOKEN_INTEGER;
+          int_value = obj.getIntValue();
+          num_value = static_cast<double>(int_value);
+        }
+        break;
+
+      case ::ot_real:
+        {
+          type      = TOKEN_REAL;
+          num_value = utils::numeric::locale_safe_numeric_value(obj);
+        }
+        break;
+
+      case ::ot_name: { type = TOKEN_NAME; } break;
+      case ::ot_string: { type = TOKEN_STRING; } break;
+      case ::ot_array: { type = TOKEN_ARRAY; } break;
+      case ::ot_dictionary: { type = TOKEN_DICT; } break;
+
+      case ::ot_operator:
+        {
+          type = TOKEN_OPERATOR;
+
+          std::string name = obj.getOperatorValue();
+          op = pdf_operator::to_name(name.c_str(), name.size());
+        }
+        break;
+
+      default: { type = TOKEN_OTHER; }
+      }
+  }
+
+  std::string qpdf_stream_instruction::key()
+  {
+    if(type==TOKEN_PARAMETER)
+      {
+        return "parameter";
+      }
+
+    return to_qpdf_object().getTypeName();
+  }
+
+  std::string qpdf_stream_instruction::val()
+  {
+    if(type==TOKEN_PARAMETER)
+      {
+        return "[]";
+      }
+
+    return to_qpdf_object().unparse();
+  }
+
   std::string qpdf_stream_instruction::unparse()
   {
-    return obj.unparse();
+    return to_qpdf_object().unparse();
+  }
+
+  bool qpdf_stream_instruction::has_obj()
+  {
+    return obj.isInitialized();
+  }
+
+  QPDFObjectHandle qpdf_stream_instruction::to_qpdf_object()
+  {
+    if(obj.isInitialized())
+      {
+        return obj;
+      }
+
+    switch(type)
+      {
+      case TOKEN_BOOL: { return QPDFObjectHandle::newBool(int_value!=0); }
+      case TOKEN_INTEGER: { return QPDFObjectHandle::newInteger(int_value); }
+      case TOKEN_REAL: { return QPDFObjectHandle::newReal(num_value); }
+      case TOKEN_NAME: { return QPDFObjectHandle::newName(str_value); }
+      case TOKEN_STRING: { return QPDFObjectHandle::newString(str_value); }
+
+      case TOKEN_OPERATOR:
+        {
+          return QPDFObjectHandle::newOperator(get_operator_name());
+        }
+
+      case TOKEN_ARRAY:
+        {
+          std::vector<QPDFObjectHandle> arr;
+          for(auto& item:items)
+            {
+              arr.push_back(item.to_qpdf_object());
+            }
+          return QPDFObjectHandle::newArray(arr);
+        }
+
+      case TOKEN_DICT:
+        {
+          // the native lexer keeps dictionaries as text
+          try
+            {
+              return QPDFObjectHandle::parse(str_value, "content-stream");
+            }
+          catch(const std::exception& exc)
+            {
+              LOG_S(ERROR) << "could not parse dictionary " << str_value << ": " << exc.what();
+            }
+          return QPDFObjectHandle::newNull();
+        }
+
+      case TOKEN_OTHER: { return QPDFObjectHandle::newInlineImage(str_value); }
+
+      default:
+        return QPDFObjectHandle::newNull();
+      }
+  }
+
+  bool qpdf_stream_instruction::is_operator()
+  {
+    return (type==TOKEN_OPERATOR);
   }
 
   bool qpdf_stream_instruction::is_integer()
   {
-    return obj.isInteger();
+    return (type==TOKEN_INTEGER);
   }
 
   bool qpdf_stream_instruction::is_number()
   {
-    return obj.isNumber();
+    return (type==TOKEN_INTEGER or type==TOKEN_REAL);
   }
 
   bool qpdf_stream_instruction::is_string()
   {
-    return (obj.isName() or obj.isString());
+    return (type==TOKEN_NAME or type==TOKEN_STRING);
   }
 
   bool qpdf_stream_instruction::is_null()
   {
-    return obj.isNull();
+    return (type==TOKEN_NULL or type==TOKEN_PARAMETER);
   }
 
   bool qpdf_stream_instruction::is_array()
   {
-    return obj.isArray();
+    return (type==TOKEN_ARRAY);
   }
 
   bool qpdf_stream_instruction::is_dict()
   {
-    return obj.isDictionary();
+    return (type==TOKEN_DICT);
+  }
+
+  std::string qpdf_stream_instruction::get_operator_name()
+  {
+    if(type!=TOKEN_OPERATOR)
+      {
+        return "";
+      }
+    else if(obj.isInitialized())
+      {
+        return obj.getOperatorValue();
+      }
+    else if(op!=pdf_operator::null)
+      {
+        return pdf_operator::to_string(op);
+      }
+
+    return str_value;
   }
-  
-  int qpdf_stream_instruction::to_int()  
-  { 
-    if(not obj.isInteger())
+
+  int qpdf_stream_instruction::to_int()
+  {
+    if(type!=TOKEN_INTEGER)
       {
 	std::string message = "obj.isInteger() is false: " + obj.unparse();
 	LOG_S(ERROR) << message;
 	throw std::logic_error(message);
       }
-    
-    return obj.getIntValue(); 
-  } 
 
-  double qpdf_stream_instruction::to_double() 
+    return int_value;
+  }
+
+  double qpdf_stream_instruction::to_double()
   {
-    if(not obj.isNumber())
+    if(type!=TOKEN_INTEGER and type!=TOKEN_REAL)
       {
 	std::string message = "obj.isNumber() is false" + obj.unparse();
 	LOG_S(ERROR) << message;
 	throw std::logic_error(message);
       }
-    
-    return utils::numeric::locale_safe_numeric_value(obj);
-  } 
 
-  std::string qpdf_stream_instruction::to_char_string() 
+    return num_value;
+  }
+
+  std::string qpdf_stream_instruction::to_char_string()
   {
-    if (obj.isName() or obj.isString())
+    if (type==TOKEN_STRING and not obj.isInitialized())
+      {
+        return str_value;
+      }
+    else if (type==TOKEN_NAME or type==TOKEN_STRING)
       {
-        return obj.getStringValue(); 
+        return to_qpdf_object().getStringValue();
       }
     else
       {
 	std::stringstream ss;
-        ss << "can not decode a string value for key: " << key 
-	   << " and value: " << val;
+        ss << "can not decode a string value for key: " << key()
+	   << " and value: " << val();
 
 	LOG_S(ERROR) << ss.str();
 	throw std::logic_error(ss.str());
       }
 
-    return "null";    
+    return "null";
   }
 
-  std::string qpdf_stream_instruction::to_utf8_string() 
+  std::string qpdf_stream_instruction::to_utf8_string()
   {
-    if (obj.isName())
+    if (type==TOKEN_NAME)
       {
-        return obj.getName(); 
+        return obj.isInitialized()? obj.getName() : str_value;
       }
-    else if (obj.isString())
+    else if (type==TOKEN_STRING)
       {
-        return obj.getUTF8Value(); 
+        return to_qpdf_object().getUTF8Value();
       }
     else
       {
 	std::stringstream ss;
-        ss << "can not decode a string value for key: " << key 
-	   << " and value: " << val;
+        ss << "can not decode a string value for key: " << key()
+	   << " and value: " << val();
 
 	LOG_S(ERROR) << ss.str();
 	throw std::logic_error(ss.str());
       }
 
     return "null";
-  } 
+  }
+
+  std::vector<qpdf_stream_instruction>& qpdf_stream_instruction::get_array_items()
+  {
+    // convert the QPDF array once, native tokens have their items already
+    if(type==TOKEN_ARRAY and items.size()==0 and obj.isInitialized())
+      {
+        for(auto item:obj.getArrayAsVector())
+          {
+            items.push_back(qpdf_stream_instruction(item));
+          }
+      }
+
+    return items;
+  }
 
 }
 
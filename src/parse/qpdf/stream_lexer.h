@@ -0,0 +1,957 @@
+//-*-C++-*-
+
+#ifndef QPDF_STREAM_LEXER_H
+#define QPDF_STREAM_LEXER_H
+
+#include <cstring>
+
+namespace pdflib
+{
+
+  // Lexer for page and form-xobject content-streams. It runs directly over
+  // the decoded bytes of the stream and produces typed tokens without
+  // creating a QPDFObjectHandle for numbers, names, strings, operators and
+  // flat arrays. Dictionaries are kept as text (they are only parameters of
+  // the marked-content operators) and parsed by QPDF on demand. Nested
+  // arrays are handed to QPDF, and so is the detection of the end of
+  // inline images.
+  //
+  // The tokens are produced in chunks (see next), so the interpreter never
+  // holds the tokens of the whole stream.
+  class pdf_stream_lexer
+  {
+  public:
+
+    pdf_stream_lexer();
+    ~pdf_stream_lexer();
+
+    // returns false if the stream data could not be decoded
+    bool set(QPDFObjectHandle& content);
+
+    bool done();
+
+    // lex at most `max_tokens` tokens into `tokens` (cleared first)
+    size_t next(std::vector<qpdf_stream_instruction>& tokens,
+                size_t max_tokens);
+
+    // pre-scan of the whole stream: the number of bytes in its string
+    // operands, which bounds the number of glyphs it shows. Used to size
+    // the page-cells up front (capped at `max_bytes`).
+    size_t estimate_text_bytes(size_t max_bytes) const;
+
+  private:
+
+    static bool is_white(char c);
+    static bool is_delimiter(char c);
+    static bool is_digit(char c);
+    static int  hex_value(char c);
+
+    void skip_white();
+
+    bool next_token(qpdf_stream_instruction& token);
+
+    void lex_name(qpdf_stream_instruction& token);
+    void lex_literal_string(qpdf_stream_instruction& token);
+    void lex_hex_string(qpdf_stream_instruction& token);
+    void lex_array(qpdf_stream_instruction& token);
+    void lex_word(qpdf_stream_instruction& token, bool repair);
+    void lex_dict(qpdf_stream_instruction& token);
+    void lex_inline_image(qpdf_stream_instruction& token);
+
+    // hand the array starting at `start` to QPDF
+    void lex_with_qpdf(qpdf_stream_instruction& token, size_t start);
+
+    // end (one past the closing delimiter) of the array/dictionary at `start`
+    size_t find_object_end(size_t start);
+
+    static bool parse_number(const char* ptr, size_t len,
+                             qpdf_stream_instruction& token);
+
+    // repair malformed numbers (e.g. "1.23-45"), see repair_value
+    static bool repair_number(const char* ptr, size_t len,
+                              qpdf_stream_instruction& token);
+
+    // the same repairs as the value_pattern_{0,1,2} of the qpdf_stream_decoder
+    static bool repair_value(const std::string& val, std::string& mvalue);
+
+  private:
+
+    std::shared_ptr<Buffer> buffer;
+
+    const char* data;
+    size_t      size;
+    size_t      pos;
+
+    bool expect_inline_image;
+
+    std::shared_ptr<BufferInputSource> inline_input;
+    QPDFTokenizer                      inline_tokenizer;
+  };
+
+  pdf_stream_lexer::pdf_stream_lexer():
+    buffer(nullptr),
+    data(nullptr),
+    size(0),
+    pos(0),
+    expect_inline_image(false),
+    inline_input(nullptr)
+  {}
+
+  pdf_stream_lexer::~pdf_stream_lexer()
+  {}
+
+  bool pdf_stream_lexer::set(QPDFObjectHandle& content)
+  {
+    buffer = nullptr;
+    data   = nullptr;
+    size   = 0;
+    pos    = 0;
+
+    expect_inline_image = false;
+    inline_input = nullptr;
+
+    if(not content.isStream())
+      {
+        LOG_S(WARNING) << "content is not a stream: " << content.getTypeName();
+        return false;
+      }
+
+    try
+      {
+        buffer = content.getStreamData(qpdf_dl_generalized);
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(WARNING) << "could not decode the content-stream: " << exc.what();
+        buffer = nullptr;
+
+        return false;
+      }
+
+    data = reinterpret_cast<const char*>(buffer->getBuffer());
+    size = buffer->getSize();
+
+    return true;
+  }
+
+  bool pdf_stream_lexer::done()
+  {
+    return (pos>=size);
+  }
+
+  size_t pdf_stream_lexer::next(std::vector<qpdf_stream_instruction>& tokens,
+                                size_t max_tokens)
+  {
+    tokens.clear();
+
+    qpdf_stream_instruction token;
+    while(tokens.size()<max_tokens and next_token(token))
+      {
+        tokens.push_back(std::move(token));
+        token = qpdf_stream_instruction();
+      }
+
+    return tokens.size();
+  }
+
+  size_t pdf_stream_lexer::estimate_text_bytes(size_t max_bytes) const
+  {
+    size_t result=0;
+
+    size_t ind=0;
+    while(ind<size and result<max_bytes)
+      {
+        char c = data[ind];
+
+        if(c=='%') // comments run until the end of the line
+          {
+            while(ind<size and data[ind]!='\n' and data[ind]!='\r')
+              {
+                ind += 1;
+              }
+          }
+        else if(c=='(')
+          {
+            int depth = 1;
+
+            ind += 1;
+            while(ind<size and depth>0)
+              {
+                switch(data[ind])
+                  {
+                  case '\\': { ind += 1; } break;
+                  case '(':  { depth += 1; } break;
+                  case ')':  { depth -= 1; } break;
+                  }
+
+                result += (depth>0)? 1 : 0;
+                ind += 1;
+              }
+          }
+        else if(c=='<' and ind+1<size and data[ind+1]=='<')
+          {
+            ind += 2;
+          }
+        else if(c=='<')
+          {
+            size_t digits=0;
+
+            ind += 1;
+            while(ind<size and data[ind]!='>')
+              {
+                digits += (hex_value(data[ind])>=0)? 1 : 0;
+                ind += 1;
+              }
+
+            result += (digits+1)/2;
+          }
+        else
+          {
+            ind += 1;
+          }
+      }
+
+    return std::min(result, max_bytes);
+  }
+
+  bool pdf_stream_lexer::is_white(char c)
+  {
+    return (c==' ' or c=='\n' or c=='\r' or c=='\t' or c=='\f' or c=='\0');
+  }
+
+  bool pdf_stream_lexer::is_delimiter(char c)
+  {
+    switch(c)
+      {
+      case '(': case ')': case '<': case '>':
+      case '[': case ']': case '{': case '}':
+      case '/': case '%':
+        return true;
+
+      default:
+        return false;
+      }
+  }
+
+  bool pdf_stream_lexer::is_digit(char c)
+  {
+    return ('0'<=c and c<='9');
+  }
+
+  int pdf_stream_lexer::hex_value(char c)
+  {
+    if('0'<=c and c<='9') { return c-'0'; }
+    if('a'<=c and c<='f') { return c-'a'+10; }
+    if('A'<=c and c<='F') { return c-'A'+10; }
+
+    return -1;
+  }
+
+  void pdf_stream_lexer::skip_white()
+  {
+    while(pos<size)
+      {
+        char c = data[pos];
+
+        if(is_white(c))
+          {
+            pos += 1;
+          }
+        else if(c=='%') // comments run until the end of the line
+          {
+            while(pos<size and data[pos]!='\n' and data[pos]!='\r')
+              {
+                pos += 1;
+              }
+          }
+        else
+          {
+            break;
+          }
+      }
+  }
+
+  bool pdf_stream_lexer::next_token(qpdf_stream_instruction& token)
+  {
+    if(expect_inline_image)
+      {
+        expect_inline_image = false;
+
+        if(pos<size)
+          {
+            lex_inline_image(token);
+            return true;
+          }
+      }
+
+    while(true)
+      {
+        skip_white();
+
+        if(pos>=size)
+          {
+            return false;
+          }
+
+        token.offset = pos;
+
+        char c = data[pos];
+        switch(c)
+          {
+          case '/': { lex_name(token); } break;
+          case '(': { lex_literal_string(token); } break;
+          case '[': { lex_array(token); } break;
+
+          case '<':
+            {
+              if(pos+1<size and data[pos+1]=='<')
+                {
+                  lex_dict(token);
+                }
+              else
+                {
+                  lex_hex_string(token);
+                }
+            }
+            break;
+
+          case ')': case '>': case ']': case '{': case '}':
+            {
+              LOG_S(WARNING) << "skipping unexpected `" << c << "` at offset " << pos
+                             << " in content-stream";
+              pos += 1;
+            }
+            continue;
+
+          default:
+            {
+              lex_word(token, true);
+
+              if(token.type==TOKEN_OPERATOR and token.op==pdf_operator::ID)
+                {
+                  expect_inline_image = true;
+                }
+            }
+          }
+
+        token.length = pos-token.offset;
+        return true;
+      }
+
+    return false;
+  }
+
+  void pdf_stream_lexer::lex_name(qpdf_stream_instruction& token)
+  {
+    token.type = TOKEN_NAME;
+
+    std::string& name = token.str_value;
+    name = "/";
+
+    pos += 1;
+    while(pos<size and not is_white(data[pos]) and not is_delimiter(data[pos]))
+      {
+        char c = data[pos];
+
+        // #xx escapes a character by its hex code
+        if(c=='#' and pos+2<size and
+           hex_value(data[pos+1])>=0 and hex_value(data[pos+2])>=0)
+          {
+            name += static_cast<char>(16*hex_value(data[pos+1]) + hex_value(data[pos+2]));
+            pos += 3;
+          }
+        else
+          {
+            name += c;
+            pos += 1;
+          }
+      }
+  }
+
+  void pdf_stream_lexer::lex_literal_string(qpdf_stream_instruction& token)
+  {
+    token.type = TOKEN_STRING;
+
+    std::string& value = token.str_value;
+    value.clear();
+
+    int depth = 1;
+
+    pos += 1;
+    while(pos<size)
+      {
+        char c = data[pos];
+
+        if(c=='\\')
+          {
+            pos += 1;
+            if(pos>=size)
+              {
+                break;
+              }
+
+            c = data[pos];
+            switch(c)
+              {
+              case 'n': { value += '\n'; pos += 1; } break;
+              case 'r': { value += '\r'; pos += 1; } break;
+              case 't': { value += '\t'; pos += 1; } break;
+              case 'b': { value += '\b'; pos += 1; } break;
+              case 'f': { value += '\f'; pos += 1; } break;
+
+              case '\r': // line continuation
+                {
+                  pos += 1;
+                  if(pos<size and data[pos]=='\n')
+                    {
+                      pos += 1;
+                    }
+                }
+                break;
+
+              case '\n': { pos += 1; } break;
+
+              default:
+                {
+                  if('0'<=c and c<='7') // up to three octal digits
+                    {
+                      int code = 0;
+                      for(int l=0; l<3 and pos<size and '0'<=data[pos] and data[pos]<='7'; l++)
+                        {
+                          code = 8*code + (data[pos]-'0');
+                          pos += 1;
+                        }
+                      value += static_cast<char>(code & 0xff);
+                    }
+                  else // `\(`, `\)`, `\\` and unknown escapes
+                    {
+                      value += c;
+                      pos += 1;
+                    }
+                }
+              }
+          }
+        else if(c=='(')
+          {
+            depth += 1;
+            value += c;
+            pos += 1;
+          }
+        else if(c==')')
+          {
+            depth -= 1;
+            pos += 1;
+
+            if(depth==0)
+              {
+                return;
+              }
+
+            value += c;
+          }
+        else if(c=='\r') // end-of-lines are normalised to `\n`
+          {
+            value += '\n';
+            pos += 1;
+
+            if(pos<size and data[pos]=='\n')
+              {
+                pos += 1;
+              }
+          }
+        else
+          {
+            value += c;
+            pos += 1;
+          }
+      }
+
+    LOG_S(WARNING) << "unterminated string in content-stream";
+  }
+
+  void pdf_stream_lexer::lex_hex_string(qpdf_stream_instruction& token)
+  {
+    token.type = TOKEN_STRING;
+
+    std::string& value = token.str_value;
+    value.clear();
+
+    int high = -1;
+
+    pos += 1;
+    while(pos<size and data[pos]!='>')
+      {
+        int val = hex_value(data[pos]);
+
+        if(val>=0)
+          {
+            if(high<0)
+              {
+                high = val;
+              }
+            else
+              {
+                value += static_cast<char>(16*high + val);
+                high = -1;
+              }
+          }
+        else if(not is_white(data[pos]))
+          {
+            LOG_S(WARNING) << "skipping invalid character in hex-string of content-stream";
+          }
+
+        pos += 1;
+      }
+
+    // an odd number of digits is completed with a 0
+    if(high>=0)
+      {
+        value += static_cast<char>(16*high);
+      }
+
+    if(pos<size)
+      {
+        pos += 1;
+      }
+  }
+
+  void pdf_stream_lexer::lex_array(qpdf_stream_instruction& token)
+  {
+    size_t start = pos;
+
+    token.type = TOKEN_ARRAY;
+    token.items.clear();
+
+    pos += 1;
+    while(true)
+      {
+        skip_white();
+
+        if(pos>=size)
+          {
+            LOG_S(WARNING) << "unterminated array in content-stream";
+            return;
+          }
+
+        char c = data[pos];
+
+        if(c==']')
+          {
+            pos += 1;
+            return;
+          }
+
+        qpdf_stream_instruction item;
+        item.offset = pos;
+
+        bool simple = true;
+        switch(c)
+          {
+          case '/': { lex_name(item); } break;
+          case '(': { lex_literal_string(item); } break;
+
+          case '<':
+            {
+              if(pos+1<size and data[pos+1]=='<')
+                {
+                  simple = false;
+                }
+              else
+                {
+                  lex_hex_string(item);
+                }
+            }
+            break;
+
+          case '[': case ')': case '>': case '{': case '}':
+            {
+              simple = false;
+            }
+            break;
+
+          default:
+            {
+              lex_word(item, false);
+              simple = (item.type!=TOKEN_OPERATOR);
+            }
+          }
+
+        // nested arrays, dictionaries and anything unexpected are left to QPDF
+        if(not simple)
+          {
+            token.items.clear();
+            lex_with_qpdf(token, start);
+
+            return;
+          }
+
+        item.length = pos-item.offset;
+        token.items.push_back(std::move(item));
+      }
+  }
+
+  void pdf_stream_lexer::lex_word(qpdf_stream_instruction& token, bool repair)
+  {
+    size_t start = pos;
+    while(pos<size and not is_white(data[pos]) and not is_delimiter(data[pos]))
+      {
+        pos += 1;
+      }
+
+    const char* ptr = data+start;
+    size_t      len = pos-start;
+
+    if(parse_number(ptr, len, token))
+      {
+        return;
+      }
+
+    if(len==4 and std::strncmp(ptr, "true", 4)==0)
+      {
+        token.type      = TOKEN_BOOL;
+        token.int_value = 1;
+      }
+    else if(len==5 and std::strncmp(ptr, "false", 5)==0)
+      {
+        token.type      = TOKEN_BOOL;
+        token.int_value = 0;
+      }
+    else if(len==4 and std::strncmp(ptr, "null", 4)==0)
+      {
+        // reinterpreted as an empty array (see qpdf_stream_decoder)
+        token.type = TOKEN_PARAMETER;
+      }
+    else
+      {
+        token.type = TOKEN_OPERATOR;
+        token.op   = pdf_operator::to_name(ptr, len);
+
+        if(token.op==pdf_operator::null)
+          {
+            token.str_value.assign(ptr, len);
+
+            if(repair)
+              {
+                repair_number(ptr, len, token);
+              }
+          }
+      }
+  }
+
+  void pdf_stream_lexer::lex_dict(qpdf_stream_instruction& token)
+  {
+    size_t start = pos;
+    pos = find_object_end(start);
+
+    token.type = TOKEN_DICT;
+    token.str_value.assign(data+start, pos-start);
+  }
+
+  void pdf_stream_lexer::lex_inline_image(qpdf_stream_instruction& token)
+  {
+    // the single white-space after `ID` is not part of the image data
+    pos += 1;
+
+    token.offset = pos;
+    token.type   = TOKEN_OTHER;
+
+    if(not inline_input)
+      {
+        inline_input = std::make_shared<BufferInputSource>("content-stream", buffer.get(), false);
+      }
+
+    // QPDF knows how to find the end of the image data (`EI`)
+    inline_input->seek(static_cast<qpdf_offset_t>(pos), SEEK_SET);
+    inline_tokenizer.expectInlineImage(*inline_input);
+
+    QPDFTokenizer::Token tok = inline_tokenizer.readToken(*inline_input, "content-stream", true);
+
+    if(tok.getType()==QPDFTokenizer::tt_inline_image)
+      {
+        pos = static_cast<size_t>(inline_input->tell());
+      }
+    else
+      {
+        LOG_S(WARNING) << "EOF in inline image of content-stream";
+        pos = size;
+      }
+
+    token.length = pos-token.offset;
+  }
+
+  void pdf_stream_lexer::lex_with_qpdf(qpdf_stream_instruction& token, size_t start)
+  {
+    pos = find_object_end(start);
+
+    token.offset = start;
+    token.items.clear();
+
+    try
+      {
+        std::string text(data+start, pos-start);
+        token.obj = QPDFObjectHandle::parse(text, "content-stream");
+
+        token.type = token.obj.isArray()? TOKEN_ARRAY : TOKEN_OTHER;
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(ERROR) << "QPDF could not parse object in content-stream: " << exc.what();
+
+        token.obj  = QPDFObjectHandle();
+        token.type = TOKEN_NULL;
+      }
+  }
+
+  size_t pdf_stream_lexer::find_object_end(size_t start)
+  {
+    size_t ind   = start;
+    int    depth = 0;
+
+    while(ind<size)
+      {
+        char c = data[ind];
+
+        if(c=='(') // skip literal strings (they can contain brackets)
+          {
+            int str_depth = 1;
+
+            ind += 1;
+            while(ind<size and str_depth>0)
+              {
+                if(data[ind]=='\\') { ind += 1; }
+                else if(data[ind]=='(') { str_depth += 1; }
+                else if(data[ind]==')') { str_depth -= 1; }
+
+                ind += 1;
+              }
+          }
+        else if(c=='%')
+          {
+            while(ind<size and data[ind]!='\n' and data[ind]!='\r') { ind += 1; }
+          }
+        else if(c=='[')
+          {
+            depth += 1;
+            ind += 1;
+          }
+        else if(c=='<' and ind+1<size and data[ind+1]=='<')
+          {
+            depth += 1;
+            ind += 2;
+          }
+        else if(c=='<') // hex-string
+          {
+            while(ind<size and data[ind]!='>') { ind += 1; }
+            ind += 1;
+          }
+        else if(c==']' or (c=='>' and ind+1<size and data[ind+1]=='>'))
+          {
+            depth -= 1;
+            ind += (c==']')? 1 : 2;
+          }
+        else
+          {
+            ind += 1;
+          }
+
+        if(depth<=0)
+          {
+            return std::min(ind, size);
+          }
+      }
+
+    return size;
+  }
+
+  bool pdf_stream_lexer::parse_number(const char* ptr, size_t len,
+                                      qpdf_stream_instruction& token)
+  {
+    // [+-]? digits [. digits] or [+-]? . digits
+    size_t ind = 0;
+
+    bool negative = false;
+    if(ind<len and (ptr[ind]=='+' or ptr[ind]=='-'))
+      {
+        negative = (ptr[ind]=='-');
+        ind += 1;
+      }
+
+    long long mantissa   = 0;
+    int       num_digits = 0;
+    int       num_decimals = 0;
+    bool      is_real    = false;
+
+    for(; ind<len; ind++)
+      {
+        char c = ptr[ind];
+
+        if(is_digit(c))
+          {
+            if(num_digits<18)
+              {
+                mantissa = 10*mantissa + (c-'0');
+              }
+
+            num_digits += 1;
+            num_decimals += is_real? 1:0;
+          }
+        else if(c=='.' and not is_real)
+          {
+            is_real = true;
+          }
+        else
+          {
+            return false;
+          }
+      }
+
+    if(num_digits==0)
+      {
+        return false;
+      }
+
+    if(not is_real and num_digits<=18)
+      {
+        token.type      = TOKEN_INTEGER;
+        token.int_value = negative? -mantissa : mantissa;
+        token.num_value = static_cast<double>(token.int_value);
+
+        return true;
+      }
+
+    token.type = TOKEN_REAL;
+
+    // A mantissa of at most 15 digits and a power of ten up to 1e22 are
+    // exact doubles, so their quotient is correctly rounded (the same
+    // value as the string conversion).
+    static const double pow10[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    if(num_digits<=15 and num_decimals<=22)
+      {
+        double value = static_cast<double>(mantissa)/pow10[num_decimals];
+        token.num_value = negative? -value : value;
+      }
+    else
+      {
+        token.num_value = utils::numeric::locale_safe_stod(std::string(ptr, len));
+      }
+
+    return true;
+  }
+
+  bool pdf_stream_lexer::repair_number(const char* ptr, size_t len,
+                                       qpdf_stream_instruction& token)
+  {
+    // All three repairs concern malformed numbers containing '-' at
+    // position > 0 (e.g. "1.23-45", "--123.4").
+    if(len<2 or std::memchr(ptr+1, '-', len-1)==NULL)
+      {
+        return false;
+      }
+
+    std::string val(ptr, len);
+    std::string mvalue;
+
+    if(not repair_value(val, mvalue))
+      {
+        return false;
+      }
+
+    LOG_S(WARNING) << "operator | " << val << " => new matched value: " << mvalue;
+
+    try
+      {
+        token.num_value = utils::numeric::locale_safe_stod(mvalue);
+      }
+    catch(const std::exception& exc)
+      {
+        LOG_S(WARNING) << "could not repair value " << val << ": " << exc.what();
+        return false;
+      }
+
+    token.type = TOKEN_REAL;
+    token.op   = pdf_operator::null;
+    token.str_value.clear();
+
+    return true;
+  }
+
+  bool pdf_stream_lexer::repair_value(const std::string& val, std::string& mvalue)
+  {
+    size_t len = val.size();
+
+    auto skip_digits = [&](size_t ind) -> size_t
+    {
+      while(ind<len and is_digit(val[ind])) { ind += 1; }
+      return ind;
+    };
+
+    // value_pattern_0: ^(\d\.\d+)(\-\d+)$ -> group 1
+    if(len>=5 and is_digit(val[0]) and val[1]=='.')
+      {
+        size_t dash = skip_digits(2);
+        if(dash>2 and dash<len and val[dash]=='-')
+          {
+            size_t end = skip_digits(dash+1);
+            if(end>dash+1 and end==len)
+              {
+                mvalue = val.substr(0, dash);
+                return true;
+              }
+          }
+      }
+
+    // value_pattern_1: ^((\-)?\d+\.\d*)(\-)(\d*)$ -> groups 1 and 4
+    {
+      size_t ind = (val[0]=='-')? 1:0;
+      size_t dot = skip_digits(ind);
+
+      if(dot>ind and dot<len and val[dot]=='.')
+        {
+          size_t dash = skip_digits(dot+1);
+          if(dash<len and val[dash]=='-' and skip_digits(dash+1)==len)
+            {
+              mvalue = val.substr(0, dash) + val.substr(dash+1);
+              return true;
+            }
+        }
+    }
+
+    // value_pattern_2: ^(\-)+((\-)\d+(\.)?(\d*))(\-)?(\d*)$ -> groups 3 and 7
+    {
+      size_t ind = 0;
+      while(ind<len and val[ind]=='-') { ind += 1; }
+
+      size_t end = skip_digits(ind);
+      if(ind>=2 and end>ind)
+        {
+          if(end<len and val[end]=='.')
+            {
+              end = skip_digits(end+1);
+            }
+
+          std::string trailing = "";
+          if(end<len and val[end]=='-')
+            {
+              size_t last = skip_digits(end+1);
+              trailing = val.substr(end+1, last-(end+1));
+              end = last;
+            }
+
+          if(end==len)
+            {
+              mvalue = "-" + trailing;
+              return true;
+            }
+        }
+    }
+
+    return false;
+  }
+
+}
+
+#endif
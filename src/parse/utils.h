@@ -7,7 +7,11 @@
 #include "utils/json.h"
 #include "utils/timer.h"
 #include "utils/files.h"
+#include "utils/mapped_file.h"
+#include "utils/binary.h"
 #include "utils/values.h"
+#include "utils/spatial_index.h"
+#include "utils/connected_boxes.h"
 #include "utils/numeric.h"
 
 #endif
@@ -0,0 +1,183 @@
+//-*-C++-*-
+
+#ifndef PDF_UTILS_BINARY_H
+#define PDF_UTILS_BINARY_H
+
+#include <cstring>
+
+namespace utils
+{
+  namespace binary
+  {
+    // Sequential writer for the compiled resource files. Values are stored
+    // in native byte-order, strings and blobs are length-prefixed.
+    class writer
+    {
+    public:
+
+      writer();
+      ~writer();
+
+      void write_uint32(uint32_t val);
+      void write_double(double val);
+
+      void write_string(const std::string& val);
+
+      const std::string& get() const;
+
+    private:
+
+      std::string data;
+    };
+
+    // Sequential reader on a (memory-mapped) buffer. Strings are copied,
+    // blobs refer into the buffer.
+    class reader
+    {
+    public:
+
+      reader();
+      reader(const char* data, size_t size);
+
+      ~reader();
+
+      bool done() const;
+
+      uint32_t read_uint32();
+      double   read_double();
+
+      std::string read_string();
+
+      // length-prefixed bytes, without copying
+      reader read_blob();
+
+      const char* data() const;
+      size_t      size() const;
+
+    private:
+
+      void check(size_t len);
+
+    private:
+
+      const char* beg;
+      const char* cur;
+      const char* end;
+    };
+
+    writer::writer():
+      data()
+    {}
+
+    writer::~writer()
+    {}
+
+    void writer::write_uint32(uint32_t val)
+    {
+      data.append(reinterpret_cast<const char*>(&val), sizeof(val));
+    }
+
+    void writer::write_double(double val)
+    {
+      data.append(reinterpret_cast<const char*>(&val), sizeof(val));
+    }
+
+    void writer::write_string(const std::string& val)
+    {
+      write_uint32(val.size());
+      data.append(val);
+    }
+
+    const std::string& writer::get() const
+    {
+      return data;
+    }
+
+    reader::reader():
+      beg(NULL),
+      cur(NULL),
+      end(NULL)
+    {}
+
+    reader::reader(const char* data, size_t size):
+      beg(data),
+      cur(data),
+      end(data+size)
+    {}
+
+    reader::~reader()
+    {}
+
+    bool reader::done() const
+    {
+      return (cur==end);
+    }
+
+    const char* reader::data() const
+    {
+      return beg;
+    }
+
+    size_t reader::size() const
+    {
+      return (end-beg);
+    }
+
+    void reader::check(size_t len)
+    {
+      if(static_cast<size_t>(end-cur)<len)
+        {
+          std::string message = "reading beyond the end of a binary resource";
+          LOG_S(ERROR) << message;
+          throw std::logic_error(message);
+        }
+    }
+
+    uint32_t reader::read_uint32()
+    {
+      check(sizeof(uint32_t));
+
+      uint32_t val;
+      std::memcpy(&val, cur, sizeof(val));
+
+      cur += sizeof(val);
+      return val;
+    }
+
+    double reader::read_double()
+    {
+      check(sizeof(double));
+
+      double val;
+      std::memcpy(&val, cur, sizeof(val));
+
+      cur += sizeof(val);
+      return val;
+    }
+
+    std::string reader::read_string()
+    {
+      uint32_t len = read_uint32();
+      check(len);
+
+      std::string val(cur, len);
+
+      cur += len;
+      return val;
+    }
+
+    reader reader::read_blob()
+    {
+      uint32_t len = read_uint32();
+      check(len);
+
+      reader blob(cur, len);
+
+      cur += len;
+      return blob;
+    }
+
+  }
+}
+
+#endif
@@ -0,0 +1,97 @@
+//-*-C++-*-
+
+#ifndef PDF_UTILS_CONNECTED_BOXES_H
+#define PDF_UTILS_CONNECTED_BOXES_H
+
+#include <array>
+
+namespace utils
+{
+  namespace spatial
+  {
+    // bboxes are {x0, y0, x1, y1}
+    bool bbox_overlaps_with_tolerance(const std::array<double, 4>& a,
+                                      const std::array<double, 4>& b,
+                                      double tolerance)
+    {
+      return a[0] <= b[2] + tolerance and a[2] + tolerance >= b[0] and
+             a[1] <= b[3] + tolerance and a[3] + tolerance >= b[1];
+    }
+
+    // Groups the boxes into components, in the order of their first box. A
+    // component starts from the first box that is not yet taken and grows
+    // by absorbing every remaining box that overlaps (within `tolerance`)
+    // the bounding box of the component so far, until none does.
+    //
+    // Note that the growth is on the bounding box, not on pairwise overlap:
+    // a box that only touches the corner of an L-shaped component joins it.
+    // The candidates are looked up in a box_index, so each step only visits
+    // the boxes around the component instead of all of them.
+    std::vector<std::array<double, 4> >
+    connected_bounding_boxes(const std::vector<std::array<double, 4> >& boxes,
+                             double tolerance)
+    {
+      std::vector<std::array<double, 4> > result;
+
+      if(boxes.size()==0)
+        {
+          return result;
+        }
+
+      const double tol = std::max(0.0, tolerance);
+
+      box_index index;
+      index.build(boxes, tol);
+
+      std::vector<bool> consumed(boxes.size(), false);
+      std::vector<uint32_t> candidates;
+
+      for(size_t i=0; i<boxes.size(); i++)
+        {
+          if(consumed[i]) { continue; }
+
+          consumed[i] = true;
+          std::array<double, 4> component = boxes[i];
+
+          bool changed = true;
+          while(changed)
+            {
+              changed = false;
+
+              // widen the query a little beyond the tolerance, so rounding
+              // in the overlap test never drops a candidate
+              double scale  = std::max({std::abs(component[0]), std::abs(component[1]),
+                                        std::abs(component[2]), std::abs(component[3])});
+              double margin = tol + 1.0e-9*(1.0 + tol + scale);
+
+              index.query({component[0]-margin, component[1]-margin,
+                           component[2]+margin, component[3]+margin}, candidates);
+
+              for(auto j:candidates)
+                {
+                  if(consumed[j]) { continue; }
+
+                  if(bbox_overlaps_with_tolerance(component, boxes[j], tol))
+                    {
+                      component = {
+                        std::min(component[0], boxes[j][0]),
+                        std::min(component[1], boxes[j][1]),
+                        std::max(component[2], boxes[j][2]),
+                        std::max(component[3], boxes[j][3])
+                      };
+                      consumed[j] = true;
+                      changed = true;
+                    }
+                }
+            }
+
+          result.push_back(component);
+        }
+
+      return result;
+    }
+
+  }
+}
+
+#endif
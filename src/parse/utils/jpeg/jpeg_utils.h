@@ -64,6 +64,7 @@ public:
   std::vector<double> decode; // length 2*ncomp; empty if absent
   bool has_decode = false;
   bool image_mask = false;
+  int scale_denom = 1; // decode at 1/scale_denom of the size (1, 2, 4 or 8), see decode_jpeg_to_raw_pixels
 };
 
 class decoded_jpeg_result {
@@ -838,6 +839,10 @@ inline std::vector<unsigned char> write_jpeg_from_raw_pixels_to_memory(
 // This is used by the bitmap pipeline to obtain raw pixel data from
 // /DCTDecode streams when QPDF cannot provide a pre-decoded buffer (e.g.
 // in thread-safe page mode).
+//
+// With params.scale_denom > 1 the image is decoded at a reduced size
+// (ceil(width/scale_denom) x ceil(height/scale_denom)); the returned
+// width/height are the actual ones.
 // ---------------------------------------------------------------------------
 inline decoded_jpeg_result decode_jpeg_to_raw_pixels(
     unsigned char const* data, std::size_t size,
@@ -904,6 +909,14 @@ inline decoded_jpeg_result decode_jpeg_to_raw_pixels(
         dinfo.out_color_space = requested_out_cs;
       }
 
+    // DCT-domain scaling: libjpeg skips the high-frequency coefficients
+    // instead of decoding at full size and downsampling afterwards
+    if(params.scale_denom > 1)
+      {
+        dinfo.scale_num   = 1;
+        dinfo.scale_denom = static_cast<unsigned int>(params.scale_denom);
+      }
+
     LOG_S(INFO) << "decode_jpeg_to_raw_pixels"
                 << ": attempt=" << attempt_name
                 << " out_color_space(before start)=" << dinfo.out_color_space;
@@ -119,8 +119,12 @@ inline uint8_t clamp_component_to_u8(int value, int precision, bool is_signed)
 
 } // namespace detail
 
+// With reduce > 0 the `reduce` highest resolution levels are discarded,
+// i.e. the image is decoded at 1/2^reduce of its size. If the codestream
+// has fewer resolution levels, the image is decoded at full size.
 inline decoded_jpx_result decode_jpx_to_raw_pixels(uint8_t const* data,
-                                                   std::size_t size)
+                                                   std::size_t size,
+                                                   int reduce = 0)
 {
   decoded_jpx_result result;
 
@@ -144,6 +148,7 @@ inline decoded_jpx_result decode_jpx_to_raw_pixels(uint8_t const* data,
 
   opj_dparameters_t params{};
   opj_set_default_decoder_parameters(&params);
+  params.cp_reduce = static_cast<OPJ_UINT32>(std::max(reduce, 0));
 
   const auto codec_format =
       detail::has_jp2_signature(data, size) ? OPJ_CODEC_JP2 : OPJ_CODEC_J2K;
@@ -170,12 +175,19 @@ inline decoded_jpx_result decode_jpx_to_raw_pixels(uint8_t const* data,
      !image ||
      !opj_decode(codec, stream, image) ||
      !opj_end_decompress(codec, stream)) {
-    LOG_S(WARNING) << "decode_jpx_to_raw_pixels: OpenJPEG decode failed";
     if(image) {
       opj_image_destroy(image);
     }
     opj_destroy_codec(codec);
     opj_stream_destroy(stream);
+
+    if(reduce > 0) {
+      LOG_S(INFO) << "decode_jpx_to_raw_pixels: reduced decode (reduce=" << reduce
+                  << ") failed, retrying at full resolution";
+      return decode_jpx_to_raw_pixels(data, size, 0);
+    }
+
+    LOG_S(WARNING) << "decode_jpx_to_raw_pixels: OpenJPEG decode failed";
     return result;
   }
 
@@ -0,0 +1,141 @@
+//-*-C++-*-
+
+#ifndef PDF_UTILS_MAPPED_FILE_H
+#define PDF_UTILS_MAPPED_FILE_H
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace utils
+{
+  namespace filesystem
+  {
+    // Read-only view on a (binary) file. On POSIX systems the file is
+    // memory-mapped, elsewhere it is read into memory. The content is never
+    // modified, so it can be read concurrently without locking.
+    class mapped_file
+    {
+    public:
+
+      mapped_file();
+      ~mapped_file();
+
+      mapped_file(const mapped_file&) = delete;
+      mapped_file& operator=(const mapped_file&) = delete;
+
+      bool open(const std::string& filename);
+      void close();
+
+      bool is_open() const;
+
+      const char* data() const;
+      size_t      size() const;
+
+    private:
+
+      const char* data_;
+      size_t      size_;
+
+      bool mapped;
+      std::vector<char> buffer;
+    };
+
+    mapped_file::mapped_file():
+      data_(NULL),
+      size_(0),
+      mapped(false),
+      buffer({})
+    {}
+
+    mapped_file::~mapped_file()
+    {
+      close();
+    }
+
+    bool mapped_file::open(const std::string& filename)
+    {
+      close();
+
+#ifndef _WIN32
+      int fd = ::open(filename.c_str(), O_RDONLY);
+      if(fd<0)
+        {
+          return false;
+        }
+
+      struct stat st;
+      if(::fstat(fd, &st)!=0 or st.st_size==0)
+        {
+          ::close(fd);
+          return false;
+        }
+
+      void* ptr = ::mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+
+      if(ptr==MAP_FAILED)
+        {
+          LOG_S(WARNING) << "could not mmap " << filename;
+          return false;
+        }
+
+      data_  = static_cast<const char*>(ptr);
+      size_  = st.st_size;
+      mapped = true;
+#else
+      std::ifstream ifs(filename, std::ios::binary);
+      if(not ifs)
+        {
+          return false;
+        }
+
+      buffer.assign(std::istreambuf_iterator<char>(ifs),
+                    std::istreambuf_iterator<char>());
+
+      data_  = buffer.data();
+      size_  = buffer.size();
+      mapped = false;
+#endif
+
+      return (size_>0);
+    }
+
+    bool mapped_file::is_open() const
+    {
+      return (size_>0);
+    }
+
+    const char* mapped_file::data() const
+    {
+      return data_;
+    }
+
+    size_t mapped_file::size() const
+    {
+      return size_;
+    }
+
+    void mapped_file::close()
+    {
+#ifndef _WIN32
+      if(mapped and data_!=NULL)
+        {
+          ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+
+      data_  = NULL;
+      size_  = 0;
+      mapped = false;
+
+      buffer.clear();
+    }
+
+  }
+}
+
+#endif
@@ -59,6 +59,10 @@ namespace pdflib
     static const std::string KEY_FONT_CMAP_RESOURCES;
     static const std::string KEY_FONT_CHARS;
 
+    // Document-wide font cache lookups (one entry per looked-up font)
+    static const std::string KEY_FONT_CACHE_HIT;
+    static const std::string KEY_FONT_CACHE_MISS;
+
     // XObject timing keys
     static const std::string KEY_DECODE_XOBJECTS_TOTAL;
 
@@ -427,6 +431,8 @@ namespace pdflib
   const std::string pdf_timings::KEY_FONT_CMAP_STREAM_DECODE = "font: font-cmap-stream-decode";
   const std::string pdf_timings::KEY_FONT_CMAP_RESOURCES = "font: font-cmap-resources";
   const std::string pdf_timings::KEY_FONT_CHARS = "font: font-chars";
+  const std::string pdf_timings::KEY_FONT_CACHE_HIT = "font: cache-hit";
+  const std::string pdf_timings::KEY_FONT_CACHE_MISS = "font: cache-miss";
   const std::string pdf_timings::KEY_DECODE_XOBJECTS_TOTAL = "decode_xobjects_total";
   const std::string pdf_timings::KEY_PARSE_STREAM_TOTAL = "parse_stream_total";
   const std::string pdf_timings::KEY_DO_FORM_MACHINERY = "do_form_machinery_total";
@@ -483,6 +489,8 @@ namespace pdflib
       KEY_FONT_CMAP_STREAM_DECODE,
       KEY_FONT_CMAP_RESOURCES,
       KEY_FONT_CHARS,
+      KEY_FONT_CACHE_HIT,
+      KEY_FONT_CACHE_MISS,
       KEY_CMAP_PARSE_TOTAL,
       KEY_CMAP_PARSE_ENDBFCHAR,
       KEY_CMAP_PARSE_ENDBFRANGE,
@@ -547,7 +555,9 @@ namespace pdflib
       {KEY_PROCESS_DOCUMENT_FROM_BYTESIO,  KEY_PROCESS_DOCUMENT_FROM_FILE},
       {KEY_QPDF_PROCESS,                   KEY_PROCESS_DOCUMENT_FROM_BYTESIO},
       {KEY_QPDF_BUILD_THREAD_SAFE_BUFFER,  KEY_PROCESS_DOCUMENT_FROM_BYTESIO},
-      {KEY_EXTRACT_DOC_ANNOTATIONS,        KEY_PROCESS_DOCUMENT_FROM_BYTESIO},
+
+      // extracted lazily, on the first get_annotations/get_meta_xml/...
+      {KEY_EXTRACT_DOC_ANNOTATIONS,        ""},
 
       // --- page decoding ---
       {KEY_DECODE_DOCUMENT,                ""},
@@ -586,6 +596,8 @@ namespace pdflib
       {KEY_FONT_CMAP_STREAM_DECODE,        KEY_FONT_CMAP},
       {KEY_FONT_CMAP_RESOURCES,            KEY_DECODE_FONTS_TOTAL},
       {KEY_FONT_CHARS,                     KEY_DECODE_FONTS_TOTAL},
+      {KEY_FONT_CACHE_HIT,                 KEY_DECODE_FONTS_TOTAL},
+      {KEY_FONT_CACHE_MISS,                KEY_DECODE_FONTS_TOTAL},
 
       // --- font cmap parsing sub-timings (live under font: font-cmap) ---
       {KEY_CMAP_PARSE_TOTAL,               KEY_FONT_CMAP},
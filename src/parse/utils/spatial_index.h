@@ -0,0 +1,358 @@
+//-*-C++-*-
+
+#ifndef PDF_UTILS_SPATIAL_INDEX_H
+#define PDF_UTILS_SPATIAL_INDEX_H
+
+#include <array>
+
+namespace utils
+{
+  namespace spatial
+  {
+    // Uniform grid over axis-aligned boxes (points are boxes of zero size).
+    // The boxes are inserted first and the index is built once, after which
+    // it is immutable and can be queried concurrently.
+    //
+    // Every box is registered in the grid-cells it overlaps. Boxes that span
+    // more than `max_cells_per_box` grid-cells (or have non-finite
+    // coordinates) are kept aside and tested on every query, so a few
+    // page-sized boxes do not blow up the index.
+    class grid_index
+    {
+      struct box_type
+      {
+        uint32_t id;
+        double x0, y0, x1, y1;
+      };
+
+    public:
+
+      grid_index(double cell_size=1.0, int64_t max_cells_per_box=64);
+      ~grid_index();
+
+      void clear();
+
+      void insert(uint32_t id, double x, double y);
+      void insert(uint32_t id, double x0, double y0, double x1, double y1);
+
+      void build();
+
+      size_t size() const;
+
+      // ids of the boxes that intersect the (closed) query box, sorted and
+      // without duplicates
+      void query(double x0, double y0, double x1, double y1,
+                 std::vector<uint32_t>& ids) const;
+
+    private:
+
+      int64_t to_cell(double val) const;
+
+      static uint64_t to_key(int64_t cx, int64_t cy);
+
+      static bool intersects(const box_type& box,
+                             double x0, double y0, double x1, double y1);
+
+    private:
+
+      double  cell_size;
+      int64_t max_cells_per_box;
+
+      bool built;
+
+      std::vector<box_type> boxes;
+
+      // (grid-cell key, index in boxes), sorted by key after build
+      std::vector<std::pair<uint64_t, uint32_t> > entries;
+
+      // indices in boxes of the oversized boxes
+      std::vector<uint32_t> large_boxes;
+    };
+
+    grid_index::grid_index(double cell_size_, int64_t max_cells_per_box_):
+      cell_size(cell_size_>0.0? cell_size_ : 1.0),
+      max_cells_per_box(max_cells_per_box_),
+      built(false),
+      boxes({}),
+      entries({}),
+      large_boxes({})
+    {}
+
+    grid_index::~grid_index()
+    {}
+
+    void grid_index::clear()
+    {
+      built = false;
+
+      boxes.clear();
+      entries.clear();
+      large_boxes.clear();
+    }
+
+    size_t grid_index::size() const
+    {
+      return boxes.size();
+    }
+
+    int64_t grid_index::to_cell(double val) const
+    {
+      // clamp to keep the cell in 32 bit (see to_key)
+      double cell = std::floor(val/cell_size);
+      cell = std::max(cell, static_cast<double>(INT32_MIN));
+      cell = std::min(cell, static_cast<double>(INT32_MAX));
+
+      return static_cast<int64_t>(cell);
+    }
+
+    uint64_t grid_index::to_key(int64_t cx, int64_t cy)
+    {
+      return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) |
+        static_cast<uint64_t>(static_cast<uint32_t>(cy));
+    }
+
+    bool grid_index::intersects(const box_type& box,
+                                double x0, double y0, double x1, double y1)
+    {
+      return (box.x0<=x1 and x0<=box.x1 and box.y0<=y1 and y0<=box.y1);
+    }
+
+    void grid_index::insert(uint32_t id, double x, double y)
+    {
+      insert(id, x, y, x, y);
+    }
+
+    void grid_index::insert(uint32_t id, double x0, double y0, double x1, double y1)
+    {
+      if(built)
+        {
+          std::string message = "inserting into a grid_index that is already built";
+          LOG_S(ERROR) << message;
+          throw std::logic_error(message);
+        }
+
+      box_type box = {id, std::min(x0, x1), std::min(y0, y1), std::max(x0, x1), std::max(y0, y1)};
+
+      uint32_t ind = boxes.size();
+      boxes.push_back(box);
+
+      if(not (std::isfinite(box.x0) and std::isfinite(box.y0) and
+              std::isfinite(box.x1) and std::isfinite(box.y1)))
+        {
+          large_boxes.push_back(ind);
+          return;
+        }
+
+      int64_t cx0 = to_cell(box.x0), cx1 = to_cell(box.x1);
+      int64_t cy0 = to_cell(box.y0), cy1 = to_cell(box.y1);
+
+      if(static_cast<double>(cx1-cx0+1)*static_cast<double>(cy1-cy0+1)>max_cells_per_box)
+        {
+          large_boxes.push_back(ind);
+          return;
+        }
+
+      for(int64_t cx=cx0; cx<=cx1; cx++)
+        {
+          for(int64_t cy=cy0; cy<=cy1; cy++)
+            {
+              entries.push_back({to_key(cx, cy), ind});
+            }
+        }
+    }
+
+    void grid_index::build()
+    {
+      std::sort(entries.begin(), entries.end());
+      built = true;
+    }
+
+    void grid_index::query(double x0, double y0, double x1, double y1,
+                           std::vector<uint32_t>& ids) const
+    {
+      ids.clear();
+
+      if(not built)
+        {
+          std::string message = "querying a grid_index that is not built";
+          LOG_S(ERROR) << message;
+          throw std::logic_error(message);
+        }
+
+      bool finite = (std::isfinite(x0) and std::isfinite(y0) and
+                     std::isfinite(x1) and std::isfinite(y1));
+
+      int64_t cx0=0, cx1=0, cy0=0, cy1=0;
+      if(finite)
+        {
+          cx0 = to_cell(std::min(x0, x1)); cx1 = to_cell(std::max(x0, x1));
+          cy0 = to_cell(std::min(y0, y1)); cy1 = to_cell(std::max(y0, y1));
+        }
+
+      double qx0 = std::min(x0, x1), qx1 = std::max(x0, x1);
+      double qy0 = std::min(y0, y1), qy1 = std::max(y0, y1);
+
+      // a query larger than the index itself is cheaper as a scan
+      if((not finite) or
+         static_cast<double>(cx1-cx0+1)*static_cast<double>(cy1-cy0+1)>entries.size())
+        {
+          for(auto& box:boxes)
+            {
+              if(intersects(box, qx0, qy0, qx1, qy1))
+                {
+                  ids.push_back(box.id);
+                }
+            }
+        }
+      else
+        {
+          for(int64_t cx=cx0; cx<=cx1; cx++)
+            {
+              for(int64_t cy=cy0; cy<=cy1; cy++)
+                {
+                  std::pair<uint64_t, uint32_t> beg(to_key(cx, cy), 0);
+
+                  for(auto itr=std::lower_bound(entries.begin(), entries.end(), beg);
+                      itr!=entries.end() and itr->first==beg.first; itr++)
+                    {
+                      const box_type& box = boxes[itr->second];
+
+                      if(intersects(box, qx0, qy0, qx1, qy1))
+                        {
+                          ids.push_back(box.id);
+                        }
+                    }
+                }
+            }
+
+          for(auto ind:large_boxes)
+            {
+              if(intersects(boxes[ind], qx0, qy0, qx1, qy1))
+                {
+                  ids.push_back(boxes[ind].id);
+                }
+            }
+        }
+
+      std::sort(ids.begin(), ids.end());
+      ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    }
+
+    // Spatial index over a list of bboxes {x0, y0, x1, y1}, where the ids are
+    // the positions in the list. The grid-cells are sized on the typical box,
+    // but their number is kept in the order of the number of boxes, so that
+    // a query that spans the page visits a linear number of grid-cells.
+    class box_index
+    {
+    public:
+
+      box_index();
+      ~box_index();
+
+      // `pad` is added to the typical size of the boxes (e.g. the tolerance
+      // of the queries). Boxes with include[i]==false are not indexed.
+      void build(const std::vector<std::array<double, 4> >& boxes, double pad=0.0,
+                 const std::vector<bool>& include={});
+
+      size_t size() const;
+
+      const std::array<double, 4>& get_bbox(size_t id) const;
+
+      // ids of the boxes that intersect the (closed) query box, sorted
+      void query(const std::array<double, 4>& bbox, std::vector<uint32_t>& ids) const;
+
+    private:
+
+      std::vector<std::array<double, 4> > boxes;
+
+      grid_index grid;
+    };
+
+    box_index::box_index():
+      boxes({}),
+      grid()
+    {}
+
+    box_index::~box_index()
+    {}
+
+    void box_index::build(const std::vector<std::array<double, 4> >& boxes_, double pad,
+                          const std::vector<bool>& include)
+    {
+      boxes = boxes_;
+
+      auto is_included = [&](size_t i) { return (include.size()==0 or include.at(i)); };
+
+      double cell_size = 1.0;
+      {
+        std::vector<double> extents;
+        extents.reserve(boxes.size());
+
+        double x0 = 0.0, y0 = 0.0, x1 = 0.0, y1 = 0.0;
+        bool   first = true;
+
+        for(size_t i=0; i<boxes.size(); i++)
+          {
+            const auto& box = boxes[i];
+
+            double extent = std::max(std::abs(box[2]-box[0]), std::abs(box[3]-box[1]));
+            if(not (is_included(i) and std::isfinite(extent)))
+              {
+                continue;
+              }
+
+            extents.push_back(extent);
+
+            x0 = first? std::min(box[0], box[2]) : std::min({x0, box[0], box[2]});
+            y0 = first? std::min(box[1], box[3]) : std::min({y0, box[1], box[3]});
+            x1 = first? std::max(box[0], box[2]) : std::max({x1, box[0], box[2]});
+            y1 = first? std::max(box[1], box[3]) : std::max({y1, box[1], box[3]});
+
+            first = false;
+          }
+
+        if(extents.size()>0)
+          {
+            auto mid = extents.begin() + extents.size()/2;
+            std::nth_element(extents.begin(), mid, extents.end());
+
+            double density = std::sqrt((x1-x0+pad)*(y1-y0+pad)/extents.size());
+
+            cell_size = std::max({1.0, *mid + pad, density});
+          }
+      }
+
+      // a ruling across the page spans about sqrt(#boxes) grid-cells, keeping
+      // those aside would make every query visit all of them
+      int64_t max_cells_per_box = 64 + 4*static_cast<int64_t>(std::sqrt(boxes.size()));
+
+      grid = grid_index(cell_size, max_cells_per_box);
+      for(size_t i=0; i<boxes.size(); i++)
+        {
+          if(is_included(i))
+            {
+              grid.insert(i, boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3]);
+            }
+        }
+      grid.build();
+    }
+
+    size_t box_index::size() const
+    {
+      return boxes.size();
+    }
+
+    const std::array<double, 4>& box_index::get_bbox(size_t id) const
+    {
+      return boxes.at(id);
+    }
+
+    void box_index::query(const std::array<double, 4>& bbox, std::vector<uint32_t>& ids) const
+    {
+      grid.query(bbox[0], bbox[1], bbox[2], bbox[3], ids);
+    }
+
+  }
+}
+
+#endif
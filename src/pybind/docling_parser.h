@@ -4,8 +4,14 @@
 #define PYBIND_PDF_PARSER_H
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <list>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <thread>
 #ifdef _WIN32
 #include <locale>
 #include <codecvt>
@@ -29,6 +35,7 @@ namespace docling
   public:
 
     docling_parser(std::string level="fatal", int max_concurrent_results=16);
+    ~docling_parser();
 
     void set_loglevel_with_label(std::string level="error");
 
@@ -58,12 +65,26 @@ namespace docling
     nlohmann::json get_meta_xml(std::string key);
     nlohmann::json get_table_of_contents(std::string key);
 
+    // raw timings of the document decoder (load and lazy extractions)
+    std::unordered_map<std::string, std::vector<double>> get_document_timings(std::string key);
+
+    // Decodes the page (without the GIL), or returns it from the cache. If
+    // the page is being prefetched, it waits for that decode instead.
     std::shared_ptr<pdflib::pdf_decoder<pdflib::PAGE>> get_page_decoder(std::string key,
                                                                         int page,
                                                                         const pdflib::decode_config& config);
 
+    // Queues the pages for decoding on the prefetch workers and returns
+    // immediately. The decoded pages go into the page-decoder cache, where
+    // get_page_decoder picks them up.
+    bool prefetch_pages(std::string key,
+                        std::vector<int> pages,
+                        const pdflib::decode_config& config);
+
   private:
 
+    constexpr static int MAX_PREFETCH_THREADS = 4;
+
     struct page_decoder_cache_entry
     {
       std::string key;
@@ -71,6 +92,23 @@ namespace docling
       page_decoder_ptr_type page_decoder;
     };
 
+    // a page that is being decoded, for the doc-decoder it was started on.
+    // The id tells a decode apart from a later one of the same page.
+    struct pending_page_decoder
+    {
+      doc_decoder_ptr_type doc_decoder;
+      std::shared_future<page_decoder_ptr_type> page_decoder;
+      uint64_t id;
+    };
+
+    struct prefetch_task
+    {
+      std::string key;
+      int page_number;
+      doc_decoder_ptr_type doc_decoder;
+      pdflib::decode_config config;
+    };
+
     bool verify_page_boundary(std::string page_boundary);
     void maybe_release_native_memory(const pdflib::decode_config& config);
     page_decoder_ptr_type find_page_decoder(const std::string& key, int page);
@@ -79,14 +117,69 @@ namespace docling
     void remove_page_decoder(const std::string& key, int page);
     void trim_page_decoders();
 
+    // Forgets the pages being decoded and drops the queued prefetches, so
+    // their decoders are not cached when they finish (e.g. after the page
+    // was unloaded to be decoded again with another config).
+    void cancel_page_decodes(const std::string& key);
+    void cancel_page_decode(const std::string& key, int page);
+
+    bool has_page_decoder(const std::string& key, int page);
+
+    page_decoder_ptr_type decode_page(const std::string& key,
+                                      int page,
+                                      const doc_decoder_ptr_type& doc_decoder,
+                                      const pdflib::decode_config& config);
+
+    page_decoder_ptr_type decode_and_cache_page(const std::string& key,
+                                                int page,
+                                                const doc_decoder_ptr_type& doc_decoder,
+                                                const pdflib::decode_config& config,
+                                                std::promise<page_decoder_ptr_type>& promise,
+                                                uint64_t pending_id);
+
+    // Returns false if the decode was cancelled in the meantime.
+    bool finish_pending_page_decoder(const std::string& key,
+                                     int page,
+                                     uint64_t pending_id);
+
+    std::shared_ptr<QPDF> acquire_page_document(const std::string& key,
+                                                const doc_decoder_ptr_type& doc_decoder,
+                                                bool keep_qpdf_warnings);
+    void release_page_document(const std::string& key,
+                               const doc_decoder_ptr_type& doc_decoder,
+                               std::shared_ptr<QPDF> page_document);
+
+    void remove_document_state(const std::string& key);
+
+    void start_prefetch_workers();
+    void prefetch_loop();
+
   private:
 
     std::string pdf_resources_dir;
 
     std::unordered_map<std::string, doc_decoder_ptr_type> doc_decoders;
     std::list<page_decoder_cache_entry> page_decoders;
+
+    // Idle QPDF documents per key. A page is decoded on a document taken
+    // from here (or opened over the shared buffer if there is none), which
+    // is returned afterwards, so concurrent decodes never share one.
+    std::unordered_map<std::string, std::vector<std::shared_ptr<QPDF>>> page_documents;
     int max_concurrent_results;
     std::atomic<int> total_processed_pages{0};
+
+    // Guards the documents, the page-decoder cache and the prefetch queue:
+    // the page decodes run without the GIL.
+    std::mutex parser_mutex;
+
+    std::map<std::pair<std::string, int>, pending_page_decoder> pending_page_decoders;
+    uint64_t pending_page_decoder_count = 0;
+
+    std::deque<prefetch_task> prefetch_tasks;
+    std::condition_variable cv_prefetch_tasks;
+    bool stop_prefetch = false;
+
+    std::vector<std::thread> prefetch_workers;
   };
 
   docling_parser::docling_parser(std::string level, int max_concurrent_results):
@@ -94,6 +187,7 @@ namespace docling
     pdf_resources_dir(resource_utils::get_resources_dir(true).string()),
     doc_decoders({}),
     page_decoders({}),
+    page_documents({}),
     max_concurrent_results(max_concurrent_results)
   {
     set_loglevel_with_label(level);
@@ -109,6 +203,25 @@ namespace docling
     pdflib::pdf_resource<pdflib::PAGE_FONT>::initialise(data, timings);
   }
 
+  docling_parser::~docling_parser()
+  {
+    {
+      std::lock_guard<std::mutex> lock(parser_mutex);
+
+      stop_prefetch = true;
+      prefetch_tasks.clear();
+    }
+    cv_prefetch_tasks.notify_all();
+
+    for(auto& worker : prefetch_workers)
+      {
+        if(worker.joinable())
+          {
+            worker.join();
+          }
+      }
+  }
+
   void docling_parser::set_loglevel_with_label(std::string level)
   {
     if(level=="info")
@@ -135,6 +248,8 @@ namespace docling
 
   std::vector<std::string> docling_parser::list_loaded_keys()
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     std::vector<std::string> keys={};
 
     // Add the key (which is the first element of the pair)
@@ -148,6 +263,8 @@ namespace docling
 
   bool docling_parser::is_loaded(std::string key)
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     return (doc_decoders.count(key)==1);
   }
 
@@ -167,7 +284,9 @@ namespace docling
 
     if (std::filesystem::exists(path_filename))
       {
-        remove_page_decoders(key);
+        std::lock_guard<std::mutex> lock(parser_mutex);
+
+        remove_document_state(key);
 
         doc_decoders[key] = std::make_shared<doc_decoder_type>();
         bool success = doc_decoders.at(key)->process_document_from_file(filename,
@@ -212,9 +331,11 @@ namespace docling
     // Get the data into a shared buffer
     auto data_buffer = std::make_shared<std::string>(data.cast<std::string>());
 
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     try
       {
-        remove_page_decoders(key);
+        remove_document_state(key);
 
         doc_decoders[key] = std::make_shared<doc_decoder_type>();
         std::string description = "parsing of " + key + " from bytesio";
@@ -245,10 +366,12 @@ namespace docling
 
   bool docling_parser::unload_document(std::string key)
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     if(doc_decoders.count(key)==1)
       {
         doc_decoders.erase(key);
-        remove_page_decoders(key);
+        remove_document_state(key);
         if(doc_decoders.empty())
           {
             total_processed_pages.store(0);
@@ -265,6 +388,8 @@ namespace docling
 
   bool docling_parser::unload_document_page(std::string key, int page_num)
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr!=doc_decoders.end())
@@ -272,6 +397,7 @@ namespace docling
         doc_decoder_ptr_type decoder_ptr = itr->second;
         decoder_ptr->unload_page(page_num);
         remove_page_decoder(key, page_num);
+        cancel_page_decode(key, page_num);
       }
     else
       {
@@ -283,6 +409,8 @@ namespace docling
 
   bool docling_parser::unload_document_pages(std::string key)
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr!=doc_decoders.end())
@@ -290,6 +418,7 @@ namespace docling
         doc_decoder_ptr_type decoder_ptr = itr->second;
         decoder_ptr->unload_pages();
         remove_page_decoders(key);
+        cancel_page_decodes(key);
       }
     else
       {
@@ -301,8 +430,13 @@ namespace docling
 
   void docling_parser::unload_documents()
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     doc_decoders.clear();
     page_decoders.clear();
+    page_documents.clear();
+    pending_page_decoders.clear();
+    prefetch_tasks.clear();
     total_processed_pages.store(0);
   }
 
@@ -360,6 +494,52 @@ namespace docling
     });
   }
 
+  bool docling_parser::has_page_decoder(const std::string& key, int page)
+  {
+    for(const auto& page_decoder : page_decoders)
+      {
+        if(page_decoder.key == key and page_decoder.page_number == page)
+          {
+            return true;
+          }
+      }
+
+    return false;
+  }
+
+  void docling_parser::remove_document_state(const std::string& key)
+  {
+    remove_page_decoders(key);
+    page_documents.erase(key);
+
+    cancel_page_decodes(key);
+  }
+
+  void docling_parser::cancel_page_decodes(const std::string& key)
+  {
+    for(auto itr = pending_page_decoders.begin(); itr != pending_page_decoders.end(); )
+      {
+        itr = (itr->first.first == key) ? pending_page_decoders.erase(itr) : std::next(itr);
+      }
+
+    prefetch_tasks.erase(std::remove_if(prefetch_tasks.begin(), prefetch_tasks.end(),
+                                        [&key](const prefetch_task& task) {
+                                          return task.key == key;
+                                        }),
+                         prefetch_tasks.end());
+  }
+
+  void docling_parser::cancel_page_decode(const std::string& key, int page)
+  {
+    pending_page_decoders.erase({key, page});
+
+    prefetch_tasks.erase(std::remove_if(prefetch_tasks.begin(), prefetch_tasks.end(),
+                                        [&key, page](const prefetch_task& task) {
+                                          return task.key == key and task.page_number == page;
+                                        }),
+                         prefetch_tasks.end());
+  }
+
   void docling_parser::trim_page_decoders()
   {
     while(static_cast<int>(page_decoders.size()) > max_concurrent_results)
@@ -370,6 +550,8 @@ namespace docling
 
   int docling_parser::number_of_pages(std::string key)
   {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr!=doc_decoders.end())
@@ -388,6 +570,8 @@ namespace docling
   {
     LOG_S(INFO) << __FUNCTION__;
 
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr==doc_decoders.end())
@@ -403,6 +587,8 @@ namespace docling
   {
     LOG_S(INFO) << __FUNCTION__;
 
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr==doc_decoders.end())
@@ -418,6 +604,8 @@ namespace docling
   {
     LOG_S(INFO) << __FUNCTION__;
 
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
 
     if(itr==doc_decoders.end())
@@ -429,46 +617,307 @@ namespace docling
     return (itr->second)->get_table_of_contents();
   }
 
+  std::unordered_map<std::string, std::vector<double>> docling_parser::get_document_timings(std::string key)
+  {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
+    auto itr = doc_decoders.find(key);
+
+    if(itr==doc_decoders.end())
+      {
+        LOG_S(ERROR) << "key not found: " << key;
+        return {};
+      }
+
+    return (itr->second)->get_timings().get_raw_data();
+  }
+
   std::shared_ptr<pdflib::pdf_decoder<pdflib::PAGE>> docling_parser::get_page_decoder(std::string key,
                                                                                       int page,
                                                                                       const pdflib::decode_config& config)
   {
     LOG_S(INFO) << __FUNCTION__ << " for key: " << key << " and page: " << page;
 
+    doc_decoder_ptr_type doc_decoder = nullptr;
+
+    std::shared_future<page_decoder_ptr_type> pending;
+    std::promise<page_decoder_ptr_type> promise;
+    uint64_t pending_id = 0;
+    {
+      std::lock_guard<std::mutex> lock(parser_mutex);
+
+      auto itr = doc_decoders.find(key);
+      if(itr == doc_decoders.end())
+        {
+          LOG_S(ERROR) << "key not found: " << key;
+          return nullptr;
+        }
+
+      auto cached_page_decoder = find_page_decoder(key, page);
+      if(cached_page_decoder != nullptr)
+        {
+          return cached_page_decoder;
+        }
+
+      doc_decoder = itr->second;
+
+      auto pending_itr = pending_page_decoders.find({key, page});
+      if(pending_itr != pending_page_decoders.end() and
+         pending_itr->second.doc_decoder == doc_decoder)
+        {
+          pending = pending_itr->second.page_decoder;
+        }
+      else
+        {
+          pending_id = ++pending_page_decoder_count;
+          pending_page_decoders[{key, page}] = {doc_decoder, promise.get_future().share(), pending_id};
+        }
+    }
+
+    if(pending.valid())
+      {
+        LOG_S(INFO) << "waiting for the prefetch of page: " << page;
+        return pending.get();
+      }
+
+    return decode_and_cache_page(key, page, doc_decoder, config, promise, pending_id);
+  }
+
+  bool docling_parser::prefetch_pages(std::string key,
+                                      std::vector<int> pages,
+                                      const pdflib::decode_config& config)
+  {
+    LOG_S(INFO) << __FUNCTION__ << " for key: " << key << " and #-pages: " << pages.size();
+
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
     auto itr = doc_decoders.find(key);
     if(itr == doc_decoders.end())
       {
         LOG_S(ERROR) << "key not found: " << key;
-        return nullptr;
+        return false;
       }
 
-    auto cached_page_decoder = find_page_decoder(key, page);
-    if(cached_page_decoder != nullptr)
+    auto& doc_decoder = itr->second;
+    int num_pages = doc_decoder->get_number_of_pages();
+
+    if(static_cast<int>(pages.size()) > max_concurrent_results)
       {
-        return cached_page_decoder;
+        LOG_S(WARNING) << "prefetching " << pages.size() << " pages into a cache of "
+                       << max_concurrent_results << " page-decoders, the first ones will be evicted";
       }
 
-    auto& doc_decoder = itr->second;
-    auto page_decoder = doc_decoder->make_thread_safe_page_decoder(
-      page,
-      config.keep_qpdf_warnings);
-    page_decoder->decode_page(config);
+    for(auto page : pages)
+      {
+        if(page < 0 or page >= num_pages)
+          {
+            LOG_S(WARNING) << "skipping prefetch of page " << page << " (0-" << num_pages-1 << ")";
+            continue;
+          }
+
+        prefetch_tasks.push_back(prefetch_task{key, page, doc_decoder, config});
+      }
+
+    start_prefetch_workers();
+    cv_prefetch_tasks.notify_all();
 
-    if(config.create_word_cells)
+    return true;
+  }
+
+  docling_parser::page_decoder_ptr_type
+  docling_parser::decode_page(const std::string& key,
+                              int page,
+                              const doc_decoder_ptr_type& doc_decoder,
+                              const pdflib::decode_config& config)
+  {
+    auto page_document = acquire_page_document(key, doc_decoder, config.keep_qpdf_warnings);
+
+    page_decoder_ptr_type page_decoder = nullptr;
+    try
       {
-        page_decoder->create_word_cells(config);
+        page_decoder = doc_decoder->make_thread_safe_page_decoder(page, page_document);
+        page_decoder->decode_page(config);
+
+        if(config.create_word_cells)
+          {
+            page_decoder->create_word_cells(config);
+          }
+
+        if(config.create_line_cells)
+          {
+            page_decoder->create_line_cells(config);
+          }
       }
+    catch(...)
+      {
+        release_page_document(key, doc_decoder, page_document);
+        throw;
+      }
+
+    release_page_document(key, doc_decoder, page_document);
+
+    return page_decoder;
+  }
 
-    if(config.create_line_cells)
+  docling_parser::page_decoder_ptr_type
+  docling_parser::decode_and_cache_page(const std::string& key,
+                                        int page,
+                                        const doc_decoder_ptr_type& doc_decoder,
+                                        const pdflib::decode_config& config,
+                                        std::promise<page_decoder_ptr_type>& promise,
+                                        uint64_t pending_id)
+  {
+    page_decoder_ptr_type page_decoder = nullptr;
+    try
       {
-        page_decoder->create_line_cells(config);
+        page_decoder = decode_page(key, page, doc_decoder, config);
+      }
+    catch(...)
+      {
+        {
+          std::lock_guard<std::mutex> lock(parser_mutex);
+          finish_pending_page_decoder(key, page, pending_id);
+        }
+
+        promise.set_exception(std::current_exception());
+        throw;
       }
 
-    add_page_decoder(key, page, page_decoder);
+    {
+      std::lock_guard<std::mutex> lock(parser_mutex);
+
+      // the page (or its document) may have been unloaded in the meantime,
+      // and possibly be decoded again with another config
+      bool still_pending = finish_pending_page_decoder(key, page, pending_id);
+
+      auto itr = doc_decoders.find(key);
+      if(still_pending and itr != doc_decoders.end() and itr->second == doc_decoder)
+        {
+          add_page_decoder(key, page, page_decoder);
+        }
+    }
+
+    promise.set_value(page_decoder);
+
     maybe_release_native_memory(config);
     return page_decoder;
   }
 
+  bool docling_parser::finish_pending_page_decoder(const std::string& key,
+                                                   int page,
+                                                   uint64_t pending_id)
+  {
+    auto itr = pending_page_decoders.find({key, page});
+    if(itr != pending_page_decoders.end() and itr->second.id == pending_id)
+      {
+        pending_page_decoders.erase(itr);
+        return true;
+      }
+
+    return false;
+  }
+
+  std::shared_ptr<QPDF> docling_parser::acquire_page_document(const std::string& key,
+                                                              const doc_decoder_ptr_type& doc_decoder,
+                                                              bool keep_qpdf_warnings)
+  {
+    {
+      std::lock_guard<std::mutex> lock(parser_mutex);
+
+      auto itr = page_documents.find(key);
+      if(itr != page_documents.end() and itr->second.size() > 0)
+        {
+          auto page_document = itr->second.back();
+          itr->second.pop_back();
+
+          return page_document;
+        }
+    }
+
+    return doc_decoder->open_thread_safe_document(keep_qpdf_warnings);
+  }
+
+  void docling_parser::release_page_document(const std::string& key,
+                                             const doc_decoder_ptr_type& doc_decoder,
+                                             std::shared_ptr<QPDF> page_document)
+  {
+    std::lock_guard<std::mutex> lock(parser_mutex);
+
+    // do not hand a document of an unloaded decoder to the next one
+    auto itr = doc_decoders.find(key);
+    if(itr != doc_decoders.end() and itr->second == doc_decoder)
+      {
+        page_documents[key].push_back(page_document);
+      }
+  }
+
+  void docling_parser::start_prefetch_workers()
+  {
+    if(prefetch_workers.size() > 0)
+      {
+        return;
+      }
+
+    int num_threads = std::thread::hardware_concurrency();
+    num_threads = std::max(1, std::min(num_threads, MAX_PREFETCH_THREADS));
+
+    LOG_S(INFO) << "starting " << num_threads << " prefetch workers";
+
+    for(int i = 0; i < num_threads; i++)
+      {
+        prefetch_workers.emplace_back(&docling_parser::prefetch_loop, this);
+      }
+  }
+
+  void docling_parser::prefetch_loop()
+  {
+    while(true)
+      {
+        prefetch_task task;
+        std::promise<page_decoder_ptr_type> promise;
+        uint64_t pending_id = 0;
+        {
+          std::unique_lock<std::mutex> lock(parser_mutex);
+          cv_prefetch_tasks.wait(lock, [this] {
+            return stop_prefetch or (not prefetch_tasks.empty());
+          });
+
+          if(stop_prefetch)
+            {
+              return;
+            }
+
+          task = prefetch_tasks.front();
+          prefetch_tasks.pop_front();
+
+          // skip pages that are decoded (or being decoded) already
+          auto pending_itr = pending_page_decoders.find({task.key, task.page_number});
+          if(has_page_decoder(task.key, task.page_number) or
+             (pending_itr != pending_page_decoders.end() and
+              pending_itr->second.doc_decoder == task.doc_decoder))
+            {
+              continue;
+            }
+
+          pending_id = ++pending_page_decoder_count;
+          pending_page_decoders[{task.key, task.page_number}] = {task.doc_decoder,
+                                                                 promise.get_future().share(),
+                                                                 pending_id};
+        }
+
+        try
+          {
+            decode_and_cache_page(task.key, task.page_number, task.doc_decoder, task.config,
+                                  promise, pending_id);
+          }
+        catch(const std::exception& exc)
+          {
+            LOG_S(ERROR) << "could not prefetch page " << task.page_number
+                         << " of key " << task.key << ": " << exc.what();
+          }
+      }
+  }
+
 }
 
 #endif
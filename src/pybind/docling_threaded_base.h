@@ -5,13 +5,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <stdexcept>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -28,6 +31,66 @@
 
 namespace docling
 {
+  // Order in which queued pages are handed to the workers.
+  //
+  //   fifo          : document by document, in page order
+  //   longest_first : by decreasing estimated cost (see pdflib::page_cost),
+  //                   so an expensive page does not start last and leave the
+  //                   other workers idle at the end of a batch
+  enum class page_scheduling
+  {
+    FIFO,
+    LONGEST_FIRST
+  };
+
+  inline page_scheduling to_page_scheduling(const std::string& name)
+  {
+    if(name == "fifo")
+      {
+        return page_scheduling::FIFO;
+      }
+    else if(name == "longest_first")
+      {
+        return page_scheduling::LONGEST_FIRST;
+      }
+
+    throw std::invalid_argument("Invalid scheduling '" + name + "', expected 'fifo' or 'longest_first'");
+  }
+
+  // A queued page. Pages are handed out by decreasing cost and then in the
+  // order they were queued; with FIFO scheduling all costs are zero.
+  struct page_task
+  {
+    std::string doc_key;
+    int page_number = 0;
+    double cost = 0.0;
+    uint64_t sequence = 0;
+  };
+
+  struct page_task_order
+  {
+    // std::priority_queue pops the largest task
+    bool operator()(const page_task& lhs, const page_task& rhs) const
+    {
+      if(lhs.cost != rhs.cost)
+        {
+          return lhs.cost < rhs.cost;
+        }
+      return lhs.sequence > rhs.sequence;
+    }
+  };
+
+  // A document for load_documents: read from `filename`, or from `buffer`
+  // when it is set.
+  struct threaded_document_source
+  {
+    std::string key;
+    std::string filename;
+    std::shared_ptr<std::string> buffer;
+    std::optional<std::string> password;
+    std::optional<std::vector<int>> page_numbers;
+  };
+
   // ---------------------------------------------------------------------------
   // docling_threaded_base<Derived, ResultType>
   //
@@ -38,7 +101,13 @@ namespace docling
   // class body is still incomplete (i.e. during base-class instantiation).
   //
   // Derived must provide:
-  //   void worker_loop();
+  //   void worker_loop(int worker_id);
+  //
+  // Documents can be loaded before or while the workers run: once started,
+  // the pages of a newly loaded document are queued right away and picked
+  // up by the waiting workers, so the pool behaves as a long-lived pipeline.
+  // The workers only exit when the pool is reset (all documents unloaded)
+  // or destroyed.
   // ---------------------------------------------------------------------------
 
   template<typename Derived, typename ResultType>
@@ -53,7 +122,10 @@ namespace docling
     docling_threaded_base(std::string loglevel,
                           int num_threads,
                           int max_concurrent_results,
-                          pdflib::decode_config config);
+                          pdflib::decode_config config,
+                          bool unload_completed_documents=false,
+                          std::string scheduling="fifo",
+                          int64_t max_result_bytes=0);
 
     ~docling_threaded_base();
 
@@ -67,6 +139,20 @@ namespace docling
                                     std::optional<std::string> password,
                                     std::optional<std::vector<int>> page_numbers = std::nullopt);
 
+    bool load_document_from_buffer(std::string key,
+                                   std::shared_ptr<std::string> buffer,
+                                   std::optional<std::string> password,
+                                   std::optional<std::vector<int>> page_numbers = std::nullopt);
+
+    // Loads the documents in parallel (up to num_threads at a time) and
+    // starts the workers first, so the pages of a document are decoded as
+    // soon as it is loaded, while the next ones are still loading. Does not
+    // need the GIL. Returns one error per source, empty when it loaded; a
+    // key that repeats an earlier source is rejected without loading it.
+    // The loaders are separate threads next to the workers, so up to
+    // 2*num_threads threads may be busy while documents are loading.
+    std::vector<std::string> load_documents(const std::vector<threaded_document_source>& sources);
+
     int number_of_pages(std::string key) const;
     int scheduled_number_of_pages(std::string key) const;
 
@@ -84,29 +170,95 @@ namespace docling
                                             int num_pages,
                                             std::optional<std::vector<int>> page_numbers) const;
     void validate_unload_state() const;
+    void validate_unload_state(const std::string& key) const;
     void reset_after_completion();
 
+    // Stores a decoded document and, once the pool is running, queues its
+    // pages. Returns false if the key still has pages being processed.
+    bool admit_document(const std::string& key,
+                        doc_decoder_ptr_type doc_decoder,
+                        std::optional<std::vector<int>> page_numbers);
+
     void build_task_queue();
 
+    // Builds the tasks for the pages of a document, with their estimated
+    // cost when scheduling longest-first. Takes no lock: the estimate parses
+    // content streams and must not stall the workers on documents_mutex.
+    std::vector<page_task> make_page_tasks(const std::string& key,
+                                           const doc_decoder_ptr_type& doc_decoder,
+                                           const std::vector<int>& pages) const;
+
+    // Queues the tasks in their given order (task_mutex is taken here).
+    void queue_tasks(std::vector<page_task> tasks);
+
+    // Starts workers for the queued pages, up to num_threads in total.
     void start_workers();
+    void stop_workers();
+
+    // Updates the per-document bookkeeping for a consumed result, and flags
+    // the result of the last page of its document.
+    void complete_page(ResultType& result);
 
   protected:
 
+    // Blocks until a task is available and pops it; returns false when the
+    // pool is stopping. `queued_pages` receives the pages left in the queue.
+    bool pop_task(std::pair<std::string, int>& task, int& queued_pages);
+
+    // Returns nullptr if the document is not (or no longer) loaded.
+    doc_decoder_ptr_type find_document(const std::string& doc_key) const;
+
+    // Blocks while the results queue is full, i.e. holds max_concurrent_results
+    // results or at least max_result_bytes; returns false (and drops the
+    // result) when the pool is stopping.
+    bool push_result(ResultType&& result);
+
     void maybe_release_native_memory();
 
+    // Returns the QPDF document this worker uses for `doc_key`, opening it
+    // over the shared buffer on first use. `open_document_s` receives the
+    // time spent opening (0 when the pool already had one).
+    std::shared_ptr<QPDF> get_worker_document(const std::string& doc_key,
+                                              int worker_id,
+                                              const doc_decoder_ptr_type& doc_decoder,
+                                              double& open_document_s);
+
+    void release_worker_documents(const std::string& doc_key);
+    void release_worker_documents();
+
     pdflib::decode_config config;
     int num_threads;
     int max_concurrent_results;
 
+    // budget on the estimated bytes held by the queued results (0: none).
+    // A result is admitted while the queue holds less than the budget, so
+    // a single large page is never blocked on an empty queue.
+    size_t max_result_bytes;
+
+    // unload a document as soon as the result of its last page is consumed
+    bool unload_completed_documents;
+
+    // Guards key2doc, key2scheduled_pages and key2pending_results, which are
+    // updated by loads (and auto-unloads) while the workers run.
+    mutable std::mutex documents_mutex;
+
     std::unordered_map<std::string, doc_decoder_ptr_type> key2doc;
-    std::unordered_map<std::string, std::vector<int>> key2scheduled_pages;
+    std::unordered_map<std::string, std::vector<page_task>> key2scheduled_pages;
+
+    // scheduled pages per document whose results are not consumed yet
+    std::unordered_map<std::string, int> key2pending_results;
+
+    page_scheduling scheduling;
 
-    // Task queue: (doc_key, page_number) pairs
-    std::queue<std::pair<std::string, int>> task_queue;
+    // Task queue, ordered by page_task_order
+    std::priority_queue<page_task, std::vector<page_task>, page_task_order> task_queue;
+    uint64_t task_sequence = 0;
     std::mutex task_mutex;
+    std::condition_variable cv_tasks_available;
 
     // Results queue with bounded capacity
     std::queue<ResultType> results_queue;
+    size_t queued_result_bytes = 0;
     std::mutex results_mutex;
     std::condition_variable cv_results_available;
     std::condition_variable cv_results_consumed;
@@ -114,10 +266,18 @@ namespace docling
     // State tracking
     std::atomic<int> tasks_remaining{0};
     std::atomic<bool> started{false};
+    std::atomic<bool> stopping{false};
     std::atomic<int> active_workers{0};
     std::atomic<int> total_processed_pages{0};
 
+    // loaders start workers concurrently (see load_documents)
     std::vector<std::thread> workers;
+    std::mutex workers_mutex;
+
+    // Per-worker QPDF documents: (doc_key, worker_id) -> document opened once
+    // over the shared buffer and reused for all of that worker's pages.
+    std::map<std::pair<std::string, int>, std::shared_ptr<QPDF>> worker_documents;
+    std::mutex worker_documents_mutex;
   };
 
   // ---------------------------------------------------------------------------
@@ -129,13 +289,20 @@ namespace docling
       std::string loglevel,
       int num_threads,
       int max_concurrent_results,
-      pdflib::decode_config config):
+      pdflib::decode_config config,
+      bool unload_completed_documents,
+      std::string scheduling,
+      int64_t max_result_bytes):
     docling_resources(),
     config(config),
     num_threads(num_threads),
     max_concurrent_results(max_concurrent_results),
+    max_result_bytes(static_cast<size_t>(std::max<int64_t>(0, max_result_bytes))),
+    unload_completed_documents(unload_completed_documents),
     key2doc({}),
-    key2scheduled_pages({})
+    key2scheduled_pages({}),
+    key2pending_results({}),
+    scheduling(to_page_scheduling(scheduling))
   {
     set_loglevel_with_label(loglevel);
 
@@ -157,13 +324,7 @@ namespace docling
   template<typename Derived, typename ResultType>
   docling_threaded_base<Derived, ResultType>::~docling_threaded_base()
   {
-    for(auto& worker : workers)
-      {
-        if(worker.joinable())
-          {
-            worker.join();
-          }
-      }
+    stop_workers();
   }
 
   template<typename Derived, typename ResultType>
@@ -198,12 +359,6 @@ namespace docling
       std::optional<std::string> password,
       std::optional<std::vector<int>> page_numbers)
   {
-    if(started.load())
-      {
-        LOG_S(ERROR) << "Cannot load documents after processing has started";
-        return false;
-      }
-
 #ifdef _WIN32
     std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
     std::wstring wide_filename = converter.from_bytes(filename);
@@ -214,41 +369,29 @@ namespace docling
 
     if(std::filesystem::exists(path_filename))
       {
+        // the document is parsed before it is stored, so the workers never
+        // see a decoder that is still being set up
+        auto doc_decoder = std::make_shared<doc_decoder_type>();
         try
           {
-            key2doc[key] = std::make_shared<doc_decoder_type>();
-            bool success = key2doc.at(key)->process_document_from_file(filename,
-                                                                       password,
-                                                                       config.keep_qpdf_warnings);
+            bool success = doc_decoder->process_document_from_file(filename,
+                                                                   password,
+                                                                   config.keep_qpdf_warnings);
             if(not success)
               {
                 // do not keep a decoder that never parsed the document: it
                 // would schedule zero pages and report a page count of -1
-                key2doc.erase(key);
                 LOG_S(ERROR) << "could not decode file object for key=" << key;
                 return false;
               }
           }
         catch(const std::exception& exc)
           {
-            key2doc.erase(key);
             LOG_S(ERROR) << "could not decode file object for key=" << key;
             return false;
           }
 
-        try
-          {
-            key2scheduled_pages[key] = normalise_page_numbers(key,
-                                                              key2doc.at(key)->get_number_of_pages(),
-                                                              page_numbers);
-          }
-        catch(const std::exception& exc)
-          {
-            key2doc.erase(key);
-            key2scheduled_pages.erase(key);
-            throw;
-          }
-        return true;
+        return admit_document(key, doc_decoder, page_numbers);
       }
 
     LOG_S(ERROR) << "File not found: " << filename;
@@ -262,12 +405,6 @@ namespace docling
       std::optional<std::string> password,
       std::optional<std::vector<int>> page_numbers)
   {
-    if(started.load())
-      {
-        LOG_S(ERROR) << "Cannot load documents after processing has started";
-        return false;
-      }
-
     LOG_S(INFO) << __FILE__ << ":" << __LINE__ << "\t" << __FUNCTION__;
 
     if(not pybind11::hasattr(bytes_io, "read"))
@@ -281,50 +418,162 @@ namespace docling
 
     auto data_buffer = std::make_shared<std::string>(data.cast<std::string>());
 
+    return load_document_from_buffer(key, data_buffer, password, page_numbers);
+  }
+
+  template<typename Derived, typename ResultType>
+  bool docling_threaded_base<Derived, ResultType>::load_document_from_buffer(
+      std::string key,
+      std::shared_ptr<std::string> data_buffer,
+      std::optional<std::string> password,
+      std::optional<std::vector<int>> page_numbers)
+  {
+    auto doc_decoder = std::make_shared<doc_decoder_type>();
     try
       {
-        key2doc[key] = std::make_shared<doc_decoder_type>();
         std::string description = "parsing of " + key + " from bytesio";
-        bool success = key2doc.at(key)->process_document_from_bytesio(data_buffer,
-                                                                      password,
-                                                                      description,
-                                                                      config.keep_qpdf_warnings);
+        bool success = doc_decoder->process_document_from_bytesio(data_buffer,
+                                                                  password,
+                                                                  description,
+                                                                  config.keep_qpdf_warnings);
         if(not success)
           {
             // do not keep a decoder that never parsed the document: it would
             // schedule zero pages and report a page count of -1
-            key2doc.erase(key);
-            key2scheduled_pages.erase(key);
-            LOG_S(ERROR) << "could not decode bytesio object for key=" << key;
+            LOG_S(ERROR) << "could not decode buffer for key=" << key;
             return false;
           }
       }
     catch(const std::exception& exc)
       {
-        key2doc.erase(key);
-        key2scheduled_pages.erase(key);
-        LOG_S(ERROR) << "could not decode bytesio object for key=" << key;
+        LOG_S(ERROR) << "could not decode buffer for key=" << key;
         return false;
       }
 
-    try
+    return admit_document(key, doc_decoder, page_numbers);
+  }
+
+  template<typename Derived, typename ResultType>
+  std::vector<std::string> docling_threaded_base<Derived, ResultType>::load_documents(
+      const std::vector<threaded_document_source>& sources)
+  {
+    std::vector<std::string> errors(sources.size());
+
+    // two loads of the same key would race on its schedule and results
+    std::unordered_set<std::string> keys;
+    for(std::size_t i = 0; i < sources.size(); i++)
       {
-        key2scheduled_pages[key] = normalise_page_numbers(key,
-                                                          key2doc.at(key)->get_number_of_pages(),
-                                                          page_numbers);
+        if(not keys.insert(sources[i].key).second)
+          {
+            errors[i] = "duplicate document key: " + sources[i].key;
+          }
       }
-    catch(const std::exception& exc)
+
+    has_tasks();
+
+    std::atomic<std::size_t> next_source{0};
+    auto load_loop = [this, &sources, &errors, &next_source]() {
+      for(std::size_t i = next_source.fetch_add(1); i < sources.size(); i = next_source.fetch_add(1))
+        {
+          if(not errors[i].empty())
+            {
+              continue;
+            }
+
+          const threaded_document_source& source = sources[i];
+          try
+            {
+              bool success = false;
+              if(source.buffer != nullptr)
+                {
+                  success = load_document_from_buffer(source.key, source.buffer,
+                                                      source.password, source.page_numbers);
+                }
+              else
+                {
+                  success = load_document(source.key, source.filename,
+                                          source.password, source.page_numbers);
+                }
+
+              if(not success)
+                {
+                  errors[i] = "could not load document with key=" + source.key;
+                }
+            }
+          catch(const std::exception& exc)
+            {
+              errors[i] = exc.what();
+            }
+        }
+    };
+
+    // the calling thread loads as well
+    int num_loaders = std::min(num_threads, static_cast<int>(sources.size()));
+
+    std::vector<std::thread> loaders;
+    for(int i = 1; i < num_loaders; i++)
       {
-        key2doc.erase(key);
-        key2scheduled_pages.erase(key);
-        throw;
+        loaders.emplace_back(load_loop);
       }
+    load_loop();
+
+    for(auto& loader : loaders)
+      {
+        loader.join();
+      }
+
+    return errors;
+  }
+
+  template<typename Derived, typename ResultType>
+  bool docling_threaded_base<Derived, ResultType>::admit_document(
+      const std::string& key,
+      doc_decoder_ptr_type doc_decoder,
+      std::optional<std::vector<int>> page_numbers)
+  {
+    std::vector<int> scheduled_pages = normalise_page_numbers(key,
+                                                              doc_decoder->get_number_of_pages(),
+                                                              page_numbers);
+
+    std::vector<page_task> scheduled_tasks = make_page_tasks(key, doc_decoder, scheduled_pages);
+
+    std::lock_guard<std::mutex> lock(documents_mutex);
+
+    auto itr = key2pending_results.find(key);
+    if(itr != key2pending_results.end() and itr->second > 0)
+      {
+        LOG_S(ERROR) << "document with key=" << key << " still has pages being processed";
+        return false;
+      }
+
+    key2doc[key] = doc_decoder;
+    key2scheduled_pages[key] = scheduled_tasks;
+
+    // before the start, has_tasks() queues all loaded documents at once
+    if(not started.load() or scheduled_tasks.empty())
+      {
+        return true;
+      }
+
+    key2pending_results[key] = static_cast<int>(scheduled_tasks.size());
+
+    // count the pages before queuing them, so get_task() never sees their
+    // results without them being accounted for
+    tasks_remaining.fetch_add(static_cast<int>(scheduled_tasks.size()));
+    queue_tasks(std::move(scheduled_tasks));
+
+    cv_tasks_available.notify_all();
+
+    start_workers();
+
     return true;
   }
 
   template<typename Derived, typename ResultType>
   int docling_threaded_base<Derived, ResultType>::number_of_pages(std::string key) const
   {
+    std::lock_guard<std::mutex> lock(documents_mutex);
+
     auto itr = key2doc.find(key);
     if(itr == key2doc.end())
       {
@@ -337,6 +586,8 @@ namespace docling
   template<typename Derived, typename ResultType>
   int docling_threaded_base<Derived, ResultType>::scheduled_number_of_pages(std::string key) const
   {
+    std::lock_guard<std::mutex> lock(documents_mutex);
+
     auto itr = key2scheduled_pages.find(key);
     if(itr == key2scheduled_pages.end())
       {
@@ -349,12 +600,22 @@ namespace docling
   template<typename Derived, typename ResultType>
   bool docling_threaded_base<Derived, ResultType>::unload_document(std::string key)
   {
-    validate_unload_state();
+    validate_unload_state(key);
+
+    bool removed_doc = false, removed_schedule = false, no_documents_left = false;
+    {
+      std::lock_guard<std::mutex> lock(documents_mutex);
+
+      removed_doc = key2doc.erase(key) > 0;
+      removed_schedule = key2scheduled_pages.erase(key) > 0;
+      key2pending_results.erase(key);
+
+      no_documents_left = key2doc.empty();
+    }
 
-    bool removed_doc = key2doc.erase(key) > 0;
-    bool removed_schedule = key2scheduled_pages.erase(key) > 0;
+    release_worker_documents(key);
 
-    if(key2doc.empty())
+    if(no_documents_left)
       {
         reset_after_completion();
       }
@@ -366,8 +627,13 @@ namespace docling
   void docling_threaded_base<Derived, ResultType>::unload_all_documents()
   {
     validate_unload_state();
-    key2doc.clear();
-    key2scheduled_pages.clear();
+    {
+      std::lock_guard<std::mutex> lock(documents_mutex);
+
+      key2doc.clear();
+      key2scheduled_pages.clear();
+      key2pending_results.clear();
+    }
     reset_after_completion();
   }
 
@@ -425,26 +691,48 @@ namespace docling
   }
 
   template<typename Derived, typename ResultType>
-  void docling_threaded_base<Derived, ResultType>::reset_after_completion()
+  void docling_threaded_base<Derived, ResultType>::validate_unload_state(const std::string& key) const
   {
-    while(not task_queue.empty())
-      {
-        task_queue.pop();
-      }
+    // other documents may keep streaming through the pool, only the pages
+    // of this one need to be consumed
+    std::lock_guard<std::mutex> lock(documents_mutex);
 
-    while(not results_queue.empty())
+    auto itr = key2pending_results.find(key);
+    if(itr != key2pending_results.end() and itr->second > 0)
       {
-        results_queue.pop();
+        throw std::runtime_error("Cannot unload documents while threaded iteration is active");
       }
+  }
 
-    for(auto& worker : workers)
-      {
-        if(worker.joinable())
-          {
-            worker.join();
-          }
-      }
-    workers.clear();
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::reset_after_completion()
+  {
+    stop_workers();
+
+    {
+      // a loader (see load_documents) may already queue pages again
+      std::scoped_lock lock(task_mutex, results_mutex);
+
+      while(not task_queue.empty())
+        {
+          task_queue.pop();
+        }
+
+      while(not results_queue.empty())
+        {
+          results_queue.pop();
+        }
+      queued_result_bytes = 0;
+    }
+    cv_results_consumed.notify_all();
+    cv_results_available.notify_all();
+
+    release_worker_documents();
+
+    {
+      std::lock_guard<std::mutex> lock(documents_mutex);
+      key2pending_results.clear();
+    }
 
     tasks_remaining.store(0);
     active_workers.store(0);
@@ -455,26 +743,209 @@ namespace docling
   template<typename Derived, typename ResultType>
   void docling_threaded_base<Derived, ResultType>::build_task_queue()
   {
+    std::lock_guard<std::mutex> lock(documents_mutex);
+
+    // has_tasks() may race with load_documents(), which runs without the GIL
+    if(started.load())
+      {
+        return;
+      }
+
+    int num_tasks = 0;
     for(const auto& pair : key2scheduled_pages)
       {
-        for(int page : pair.second)
+        if(pair.second.empty())
           {
-            task_queue.push(std::make_pair(pair.first, page));
+            continue;
           }
+
+        // the costs were estimated when the document was admitted
+        queue_tasks(pair.second);
+
+        key2pending_results[pair.first] = static_cast<int>(pair.second.size());
+        num_tasks += static_cast<int>(pair.second.size());
       }
 
-    tasks_remaining.store(static_cast<int>(task_queue.size()));
+    tasks_remaining.store(num_tasks);
+
+    // from here on, loaded documents are queued by admit_document
+    started.store(true);
+  }
+
+  template<typename Derived, typename ResultType>
+  std::vector<page_task> docling_threaded_base<Derived, ResultType>::make_page_tasks(
+      const std::string& key,
+      const doc_decoder_ptr_type& doc_decoder,
+      const std::vector<int>& pages) const
+  {
+    std::vector<page_task> tasks(pages.size());
+    for(std::size_t i = 0; i < pages.size(); i++)
+      {
+        tasks[i].doc_key = key;
+        tasks[i].page_number = pages[i];
+
+        // the estimate reads the loader's own QPDF document, which the
+        // workers never touch
+        if(scheduling == page_scheduling::LONGEST_FIRST)
+          {
+            tasks[i].cost = doc_decoder->estimate_page_cost(pages[i]);
+          }
+      }
+
+    return tasks;
+  }
+
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::queue_tasks(std::vector<page_task> tasks)
+  {
+    std::lock_guard<std::mutex> lock(task_mutex);
+    for(auto& task : tasks)
+      {
+        task.sequence = task_sequence++;
+        task_queue.push(std::move(task));
+      }
   }
 
   template<typename Derived, typename ResultType>
   void docling_threaded_base<Derived, ResultType>::start_workers()
   {
-    int num_workers = std::min(num_threads, static_cast<int>(task_queue.size()));
-    active_workers.store(num_workers);
+    int queued_pages = 0;
+    {
+      std::lock_guard<std::mutex> lock(task_mutex);
+      queued_pages = static_cast<int>(task_queue.size());
+    }
+
+    std::lock_guard<std::mutex> lock(workers_mutex);
 
-    for(int i = 0; i < num_workers; i++)
+    // idle workers pick up queued pages as well, so this may start a few
+    // workers too many, but never more than num_threads
+    int num_workers = std::min(num_threads, static_cast<int>(workers.size()) + queued_pages);
+
+    for(int i = static_cast<int>(workers.size()); i < num_workers; i++)
       {
-        workers.emplace_back(&Derived::worker_loop, static_cast<Derived*>(this));
+        active_workers.fetch_add(1);
+        workers.emplace_back(&Derived::worker_loop, static_cast<Derived*>(this), i);
+      }
+  }
+
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::stop_workers()
+  {
+    {
+      // set under both locks, so no worker misses the wake-up below
+      std::scoped_lock lock(task_mutex, results_mutex);
+      stopping.store(true);
+    }
+    cv_tasks_available.notify_all();
+    cv_results_consumed.notify_all();
+
+    {
+      std::lock_guard<std::mutex> lock(workers_mutex);
+      for(auto& worker : workers)
+        {
+          if(worker.joinable())
+            {
+              worker.join();
+            }
+        }
+      workers.clear();
+    }
+
+    stopping.store(false);
+  }
+
+  template<typename Derived, typename ResultType>
+  bool docling_threaded_base<Derived, ResultType>::pop_task(std::pair<std::string, int>& task,
+                                                            int& queued_pages)
+  {
+    std::unique_lock<std::mutex> lock(task_mutex);
+
+    cv_tasks_available.wait(lock, [this]() {
+      return stopping.load() or not task_queue.empty();
+    });
+
+    if(stopping.load())
+      {
+        return false;
+      }
+
+    task = std::make_pair(task_queue.top().doc_key, task_queue.top().page_number);
+    task_queue.pop();
+
+    queued_pages = static_cast<int>(task_queue.size());
+    return true;
+  }
+
+  template<typename Derived, typename ResultType>
+  typename docling_threaded_base<Derived, ResultType>::doc_decoder_ptr_type
+  docling_threaded_base<Derived, ResultType>::find_document(const std::string& doc_key) const
+  {
+    std::lock_guard<std::mutex> lock(documents_mutex);
+
+    auto itr = key2doc.find(doc_key);
+    if(itr == key2doc.end())
+      {
+        return nullptr;
+      }
+
+    return itr->second;
+  }
+
+  template<typename Derived, typename ResultType>
+  bool docling_threaded_base<Derived, ResultType>::push_result(ResultType&& result)
+  {
+    // estimated before queuing: once queued, the consumer may take it
+    result.memory_bytes = estimate_result_bytes(result);
+
+    std::unique_lock<std::mutex> lock(results_mutex);
+
+    cv_results_consumed.wait(lock, [this]() {
+      return stopping.load() or
+        (static_cast<int>(results_queue.size()) < max_concurrent_results and
+         (max_result_bytes==0 or queued_result_bytes < max_result_bytes));
+    });
+
+    if(stopping.load())
+      {
+        return false;
+      }
+
+    queued_result_bytes += result.memory_bytes;
+    results_queue.push(std::move(result));
+    cv_results_available.notify_one();
+
+    return true;
+  }
+
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::complete_page(ResultType& result)
+  {
+    bool unloaded = false;
+    {
+      std::lock_guard<std::mutex> lock(documents_mutex);
+
+      auto itr = key2pending_results.find(result.doc_key);
+      if(itr == key2pending_results.end() or (--itr->second) > 0)
+        {
+          return;
+        }
+      key2pending_results.erase(itr);
+
+      result.document_completed = true;
+
+      if(unload_completed_documents)
+        {
+          key2doc.erase(result.doc_key);
+          key2scheduled_pages.erase(result.doc_key);
+          unloaded = true;
+        }
+    }
+
+    // the page decoders of the results keep their own QPDF document, so
+    // the pooled ones can go with the document
+    if(unloaded)
+      {
+        release_worker_documents(result.doc_key);
       }
   }
 
@@ -494,6 +965,67 @@ namespace docling
       }
   }
 
+  template<typename Derived, typename ResultType>
+  std::shared_ptr<QPDF> docling_threaded_base<Derived, ResultType>::get_worker_document(
+      const std::string& doc_key,
+      int worker_id,
+      const doc_decoder_ptr_type& doc_decoder,
+      double& open_document_s)
+  {
+    using clock_type = std::chrono::steady_clock;
+
+    const auto pool_key = std::make_pair(doc_key, worker_id);
+
+    open_document_s = 0.0;
+    {
+      std::lock_guard<std::mutex> lock(worker_documents_mutex);
+
+      auto itr = worker_documents.find(pool_key);
+      if(itr != worker_documents.end())
+        {
+          return itr->second;
+        }
+    }
+
+    // Only this worker inserts under its own id, so the document can be
+    // opened without holding the pool lock.
+    auto start = clock_type::now();
+    std::shared_ptr<QPDF> document = doc_decoder->open_thread_safe_document(config.keep_qpdf_warnings);
+    open_document_s = std::chrono::duration<double>(clock_type::now() - start).count();
+
+    {
+      std::lock_guard<std::mutex> lock(worker_documents_mutex);
+      worker_documents[pool_key] = document;
+    }
+
+    return document;
+  }
+
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::release_worker_documents(const std::string& doc_key)
+  {
+    std::lock_guard<std::mutex> lock(worker_documents_mutex);
+
+    for(auto itr = worker_documents.begin(); itr != worker_documents.end(); )
+      {
+        if(itr->first.first == doc_key)
+          {
+            itr = worker_documents.erase(itr);
+          }
+        else
+          {
+            itr++;
+          }
+      }
+  }
+
+  template<typename Derived, typename ResultType>
+  void docling_threaded_base<Derived, ResultType>::release_worker_documents()
+  {
+    std::lock_guard<std::mutex> lock(worker_documents_mutex);
+    worker_documents.clear();
+  }
+
   template<typename Derived, typename ResultType>
   bool docling_threaded_base<Derived, ResultType>::has_tasks()
   {
@@ -501,7 +1033,6 @@ namespace docling
       {
         build_task_queue();
         start_workers();
-        started.store(true);
       }
 
     return tasks_remaining.load() > 0;
@@ -512,8 +1043,10 @@ namespace docling
   {
     std::unique_lock<std::mutex> lock(results_mutex);
 
+    // the workers stay alive between documents, so wait on the pages still
+    // owed rather than on the workers
     cv_results_available.wait(lock, [this]() {
-      return not results_queue.empty() or active_workers.load() == 0;
+      return not results_queue.empty() or tasks_remaining.load() == 0 or active_workers.load() == 0;
     });
 
     if(results_queue.empty())
@@ -528,11 +1061,22 @@ namespace docling
 
     ResultType result = std::move(results_queue.front());
     results_queue.pop();
+    queued_result_bytes -= result.memory_bytes;
     tasks_remaining.fetch_sub(1);
 
     lock.unlock();
 
-    cv_results_consumed.notify_one();
+    // a large result can make room for several small ones
+    if(max_result_bytes==0)
+      {
+        cv_results_consumed.notify_one();
+      }
+    else
+      {
+        cv_results_consumed.notify_all();
+      }
+
+    complete_page(result);
 
     return result;
   }
@@ -17,34 +17,34 @@ namespace docling
     docling_threaded_parser(std::string loglevel,
                             int num_threads,
                             int max_concurrent_results,
-                            pdflib::decode_config config):
+                            pdflib::decode_config config,
+                            bool unload_completed_documents=false,
+                            std::string scheduling="fifo",
+                            int64_t max_result_bytes=0):
       docling_threaded_base<docling_threaded_parser, page_decode_result>(loglevel,
                                                                          num_threads,
                                                                          max_concurrent_results,
-                                                                         config)
+                                                                         config,
+                                                                         unload_completed_documents,
+                                                                         scheduling,
+                                                                         max_result_bytes)
     {}
 
-    void worker_loop();
+    void worker_loop(int worker_id);
   };
 
-  inline void docling_threaded_parser::worker_loop()
+  inline void docling_threaded_parser::worker_loop(int worker_id)
   {
     using clock_type = std::chrono::steady_clock;
 
     while(true)
       {
         std::pair<std::string, int> task;
-        {
-          std::lock_guard<std::mutex> lock(task_mutex);
-
-          if(task_queue.empty())
-            {
-              break;
-            }
-
-          task = task_queue.front();
-          task_queue.pop();
-        }
+        int queued_pages = 0;
+        if(not pop_task(task, queued_pages))
+          {
+            break;
+          }
 
         const std::string& doc_key = task.first;
         int page_number = task.second;
@@ -55,22 +55,24 @@ namespace docling
 
         try
           {
-            auto itr = key2doc.find(doc_key);
-            if(itr == key2doc.end())
+            auto doc_decoder = find_document(doc_key);
+            if(doc_decoder == nullptr)
               {
                 result.success = false;
                 result.error_message = "Document key not found: " + doc_key;
               }
             else
               {
-                auto& doc_decoder = itr->second;
-
                 auto total_start = clock_type::now();
 
+                auto worker_document = get_worker_document(doc_key,
+                                                           worker_id,
+                                                           doc_decoder,
+                                                           result.timings.open_document_s);
+
                 auto stage_start = clock_type::now();
-                auto page_decoder = doc_decoder->make_thread_safe_page_decoder(
-                  page_number,
-                  config.keep_qpdf_warnings);
+                auto page_decoder = doc_decoder->make_thread_safe_page_decoder(page_number,
+                                                                               worker_document);
                 result.timings.make_page_decoder_s
                   = std::chrono::duration<double>(clock_type::now() - stage_start).count();
 
@@ -108,16 +110,10 @@ namespace docling
               + " of " + doc_key + ": " + exc.what();
           }
 
-        {
-          std::unique_lock<std::mutex> lock(results_mutex);
-
-          cv_results_consumed.wait(lock, [this]() {
-            return static_cast<int>(results_queue.size()) < max_concurrent_results;
-          });
-
-          results_queue.push(std::move(result));
-          cv_results_available.notify_one();
-        }
+        if(not push_result(std::move(result)))
+          {
+            break;
+          }
 
         maybe_release_native_memory();
       }
@@ -21,14 +21,28 @@ namespace docling
                               int num_threads,
                               int max_concurrent_results,
                               pdflib::decode_config decode_config,
-                              pdflib::render_config render_config);
+                              pdflib::render_config render_config,
+                              bool unload_completed_documents=false,
+                              std::string scheduling="fifo",
+                              int64_t max_result_bytes=0);
 
-    void worker_loop();
+    void worker_loop(int worker_id);
+
+  private:
+
+    // Blend2D threads for the next page when render_config.render_threads is
+    // -1: the worker threads that page-level parallelism leaves idle, i.e.
+    // once fewer pages remain than workers, shared evenly among the pages
+    // still being rendered. The renderer caps it further by canvas size.
+    int get_render_threads(int queued_pages) const;
 
   private:
 
     pdflib::render_config render_cfg;
 
+    // pages between task pick-up and result hand-off, across all workers
+    std::atomic<int> pages_in_flight{0};
+
     // Shared across workers; pages keep only their tiny local alias cache.
     std::shared_ptr<pdflib::blend2d_font_resolver> font_resolver_;
 
@@ -46,11 +60,17 @@ namespace docling
                                                               int num_threads,
                                                               int max_concurrent_results,
                                                               pdflib::decode_config decode_config,
-                                                              pdflib::render_config render_config):
+                                                              pdflib::render_config render_config,
+                                                              bool unload_completed_documents,
+                                                              std::string scheduling,
+                                                              int64_t max_result_bytes):
     docling_threaded_base<docling_threaded_renderer, page_render_result>(loglevel,
                                                                          num_threads,
                                                                          max_concurrent_results,
-                                                                         decode_config),
+                                                                         decode_config,
+                                                                         unload_completed_documents,
+                                                                         scheduling,
+                                                                         max_result_bytes),
     render_cfg(render_config),
     font_resolver_(std::make_shared<pdflib::blend2d_font_resolver>()),
     embedded_font_cache_(std::make_shared<pdflib::blend2d_embedded_font_cache>()),
@@ -63,24 +83,35 @@ namespace docling
     config.extract_font_programs = true;
   }
 
-  inline void docling_threaded_renderer::worker_loop()
+  inline int docling_threaded_renderer::get_render_threads(int queued_pages) const
+  {
+    if(render_cfg.render_threads >= 0)
+      {
+        return render_cfg.render_threads;
+      }
+
+    const int busy_pages = std::max(1, pages_in_flight.load() + queued_pages);
+    if(busy_pages >= num_threads)
+      {
+        return 0;
+      }
+
+    return num_threads / busy_pages;
+  }
+
+  inline void docling_threaded_renderer::worker_loop(int worker_id)
   {
     using clock_type = std::chrono::steady_clock;
 
     while(true)
       {
         std::pair<std::string, int> task;
-        {
-          std::lock_guard<std::mutex> lock(task_mutex);
-
-          if(task_queue.empty())
-            {
-              break;
-            }
-
-          task = task_queue.front();
-          task_queue.pop();
-        }
+        int queued_pages = 0;
+        if(not pop_task(task, queued_pages))
+          {
+            break;
+          }
+        pages_in_flight.fetch_add(1);
 
         const std::string& doc_key = task.first;
         int page_number = task.second;
@@ -91,22 +122,24 @@ namespace docling
 
         try
           {
-            auto itr = key2doc.find(doc_key);
-            if(itr == key2doc.end())
+            auto doc_decoder = find_document(doc_key);
+            if(doc_decoder == nullptr)
               {
                 result.success = false;
                 result.error_message = "Document key not found: " + doc_key;
               }
             else
               {
-                auto& doc_decoder = itr->second;
-
                 auto total_start = clock_type::now();
 
+                auto worker_document = get_worker_document(doc_key,
+                                                           worker_id,
+                                                           doc_decoder,
+                                                           result.timings.open_document_s);
+
                 auto stage_start = clock_type::now();
-                auto page_decoder = doc_decoder->make_thread_safe_page_decoder(
-                  page_number,
-                  config.keep_qpdf_warnings);
+                auto page_decoder = doc_decoder->make_thread_safe_page_decoder(page_number,
+                                                                               worker_document);
                 result.timings.make_page_decoder_s
                   = std::chrono::duration<double>(clock_type::now() - stage_start).count();
 
@@ -131,8 +164,11 @@ namespace docling
                       = std::chrono::duration<double>(clock_type::now() - stage_start).count();
                   }
 
+                pdflib::render_config page_render_cfg = render_cfg;
+                page_render_cfg.render_threads = get_render_threads(queued_pages);
+
                 stage_start = clock_type::now();
-                pdflib::renderer<pdflib::BLEND2D> rnd(render_cfg,
+                pdflib::renderer<pdflib::BLEND2D> rnd(page_render_cfg,
                                                       font_resolver_,
                                                       embedded_font_cache_,
                                                       freetype_font_cache_);
@@ -146,6 +182,7 @@ namespace docling
                 result.page_decoder = page_decoder;
                 result.image_data   = rnd.get_canvas();
                 result.image_shape  = rnd.get_shape();
+                result.render_threads = static_cast<int>(rnd.get_context_thread_count());
               }
           }
         catch(const std::exception& exc)
@@ -155,16 +192,12 @@ namespace docling
               + " of " + doc_key + ": " + exc.what();
           }
 
-        {
-          std::unique_lock<std::mutex> lock(results_mutex);
-
-          cv_results_consumed.wait(lock, [this]() {
-            return static_cast<int>(results_queue.size()) < max_concurrent_results;
-          });
+        pages_in_flight.fetch_sub(1);
 
-          results_queue.push(std::move(result));
-          cv_results_available.notify_one();
-        }
+        if(not push_result(std::move(result)))
+          {
+            break;
+          }
 
         maybe_release_native_memory();
       }
@@ -14,6 +14,9 @@ namespace docling
 {
   struct page_decode_timings
   {
+    // time spent opening the worker's pooled QPDF document; only non-zero
+    // for the first page a worker decodes from a given document
+    double open_document_s = 0.0;
     double make_page_decoder_s = 0.0;
     double decode_page_s = 0.0;
     double create_word_cells_s = 0.0;
@@ -33,6 +36,13 @@ namespace docling
     bool success = false;
     std::string error_message;
     std::shared_ptr<pdflib::pdf_decoder<pdflib::PAGE>> page_decoder;
+
+    // set on the last result of its document handed out by get_task()
+    bool document_completed = false;
+
+    // estimated heap held by the result, set when it is queued (see
+    // docling_threaded_base::push_result)
+    size_t memory_bytes = 0;
   };
 
   struct page_decode_result : page_task_result
@@ -49,7 +59,29 @@ namespace docling
     //   Image.frombuffer("RGBA", (w, h), data, "raw", "RGBA", 0, 1)
     std::shared_ptr<std::vector<unsigned char>> image_data;
     std::array<int, 3> image_shape{0, 0, 4}; // {height, width, channels}
+
+    // Blend2D worker threads the page was rasterized on (0: synchronously)
+    int render_threads = 0;
   };
+
+  // Approximate heap held by a result: the decoded cells and image streams
+  // of its page, plus the rendered canvas.
+  inline size_t estimate_result_bytes(const page_task_result& result)
+  {
+    return (result.page_decoder!=nullptr)? result.page_decoder->estimate_memory_bytes() : 0;
+  }
+
+  inline size_t estimate_result_bytes(const page_render_result& result)
+  {
+    size_t bytes = estimate_result_bytes(static_cast<const page_task_result&>(result));
+
+    if(result.image_data!=nullptr)
+      {
+        bytes += result.image_data->size();
+      }
+
+    return bytes;
+  }
 }
 
 #endif
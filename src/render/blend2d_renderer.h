@@ -21,6 +21,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -97,6 +98,10 @@ namespace pdflib
     // set_size() this is {0, 0, 4}.
     const std::array<int, 3>& get_shape() const { return shape_; }
 
+    // Number of Blend2D worker threads the page context was created with
+    // (0 when it rendered synchronously or no canvas was created).
+    uint32_t get_context_thread_count() const { return context_thread_count_; }
+
     // Save the canvas to a file.  The format is inferred from the extension
     // (e.g. ".png", ".bmp").  PNG is recommended; it is built into Blend2D.
     void save(const std::string& path) const;
@@ -105,6 +110,10 @@ namespace pdflib
     // image viewer (like PIL's Image.show()).
     void show() const;
 
+    // Below this number of canvas pixels per thread, asynchronous rendering
+    // costs more in synchronization than it gains (see render_threads).
+    constexpr static int64_t MIN_PIXELS_PER_RENDER_THREAD = 1 << 20;
+
   private:
 
     struct bitmap_quad
@@ -139,11 +148,16 @@ namespace pdflib
     mutable BLImage    image_;  // internal canvas (PRGB32 format)
     mutable BLContext  context_;
     mutable bool       context_active_ = false;
+    uint32_t           context_thread_count_ = 0;
     std::array<int, 3> shape_;  // {height, width, 4}
     double scale_x_ = 1.0;     // pdf-to-canvas scale along x
     double scale_y_ = 1.0;     // pdf-to-canvas scale along y
-    double origin_x_ = 0.0;    // crop_bbox x origin (pdf units)
-    double origin_y_ = 0.0;    // crop_bbox y origin (pdf units, y-up)
+    double origin_x_ = 0.0;    // crop_bbox (or region) x origin (pdf units)
+    double origin_y_ = 0.0;    // crop_bbox (or region) y origin (pdf units, y-up)
+
+    // render_config.region in pdf units, clipped to the crop box
+    bool has_region_ = false;
+    std::array<double, 4> region_ = {0.0, 0.0, 0.0, 0.0};
 
     std::shared_ptr<blend2d_font_resolver> font_resolver_;
     std::shared_ptr<blend2d_embedded_font_cache> embedded_font_cache_;
@@ -158,6 +172,17 @@ namespace pdflib
     // drawing operations before canvas extraction or file output.
     void finish_page_context() const;
 
+    // Number of Blend2D worker threads for the page context, from
+    // render_config.render_threads capped by the canvas size (0 means
+    // synchronous rendering).
+    uint32_t get_render_thread_count() const;
+
+    // False when the quad, widened by `margin` (pdf units), lies outside of
+    // the rendered region, so the instruction can be skipped.
+    bool intersects_region(const std::array<double, 4>& xs,
+                           const std::array<double, 4>& ys,
+                           double margin) const;
+
     // Convert PDF coordinates (origin at crop_bbox bottom-left, y-up) to
     // canvas coordinates (origin top-left, y-down), applying scale.
     double canvas_x(double pdf_x) const { return (pdf_x - origin_x_) * scale_x_; }
@@ -716,7 +741,10 @@ namespace pdflib
         throw std::runtime_error("renderer<BLEND2D>::page_context: canvas is empty");
       }
 
-    const BLResult err = context_.begin(image_);
+    BLContextCreateInfo create_info{};
+    create_info.thread_count = get_render_thread_count();
+
+    const BLResult err = context_.begin(image_, create_info);
     if (err != BL_SUCCESS)
       {
         throw std::runtime_error(
@@ -725,9 +753,48 @@ namespace pdflib
       }
 
     context_active_ = true;
+    context_thread_count_ = create_info.thread_count;
+
     return context_;
   }
 
+  inline bool renderer<BLEND2D>::intersects_region(const std::array<double, 4>& xs,
+                                                   const std::array<double, 4>& ys,
+                                                   double margin) const
+  {
+    if (not has_region_)
+      {
+        return true;
+      }
+
+    const auto [x0, x1] = std::minmax({xs[0], xs[1], xs[2], xs[3]});
+    const auto [y0, y1] = std::minmax({ys[0], ys[1], ys[2], ys[3]});
+
+    // keep instructions with non-finite coordinates, as without a region
+    if (not (std::isfinite(x0) and std::isfinite(x1) and
+             std::isfinite(y0) and std::isfinite(y1)))
+      {
+        return true;
+      }
+
+    return (x0 - margin <= region_[2] and region_[0] <= x1 + margin and
+            y0 - margin <= region_[3] and region_[1] <= y1 + margin);
+  }
+
+  inline uint32_t renderer<BLEND2D>::get_render_thread_count() const
+  {
+    int64_t threads = config_.render_threads;
+    if (threads < 0)
+      {
+        threads = static_cast<int64_t>(std::thread::hardware_concurrency());
+      }
+
+    const int64_t pixels = static_cast<int64_t>(shape_[0]) * shape_[1];
+    threads = std::min(threads, pixels / MIN_PIXELS_PER_RENDER_THREAD);
+
+    return threads >= 2 ? static_cast<uint32_t>(threads) : 0u;
+  }
+
   inline void renderer<BLEND2D>::finish_page_context() const
   {
     if (not context_active_)
@@ -759,13 +826,41 @@ namespace pdflib
 
     if (pdf_w <= 0 or pdf_h <= 0) { return; }
 
-    const auto [width, height] = resolve_canvas_size(pdf_w, pdf_h, config_);
+    auto [width, height] = resolve_canvas_size(pdf_w, pdf_h, config_);
 
     scale_x_ = static_cast<double>(width)  / pdf_w;
     scale_y_ = static_cast<double>(height) / pdf_h;
     origin_x_ = static_cast<double>(bbox[0]);
     origin_y_ = static_cast<double>(bbox[1]);
 
+    has_region_ = false;
+    if (config_.has_region())
+      {
+        // the region keeps the page resolution, only the canvas shrinks
+        const auto& region = config_.region;
+        region_ = {
+          std::max(origin_x_ + region[0], static_cast<double>(bbox[0])),
+          std::max(origin_y_ + region[1], static_cast<double>(bbox[1])),
+          std::min(origin_x_ + region[2], static_cast<double>(bbox[2])),
+          std::min(origin_y_ + region[3], static_cast<double>(bbox[3]))
+        };
+
+        if (region_[2] <= region_[0] or region_[3] <= region_[1])
+          {
+            LOG_S(WARNING) << "set_size: region does not intersect the crop box";
+            shape_ = {0, 0, 4};
+            return;
+          }
+
+        has_region_ = true;
+
+        width  = std::max(1, static_cast<int>(std::round((region_[2] - region_[0]) * scale_x_)));
+        height = std::max(1, static_cast<int>(std::round((region_[3] - region_[1]) * scale_y_)));
+
+        origin_x_ = region_[0];
+        origin_y_ = region_[1];
+      }
+
     shape_ = {height, width, 4};
 
     LOG_S(INFO) << "set_size:"
@@ -776,20 +871,14 @@ namespace pdflib
 
     image_.create(width, height, BL_FORMAT_PRGB32);
 
-    // Initialise canvas to opaque white.
-    const BLResult ctx_res = context_.begin(image_);
-    if (ctx_res != BL_SUCCESS)
-      {
-        throw std::runtime_error(
-          "renderer<BLEND2D>::set_size: failed to begin Blend2D context "
-          "(BLResult=" + std::to_string(ctx_res) + ")");
-      }
-    context_active_ = true;
+    // Initialise canvas to opaque white, in the (possibly threaded) page
+    // context the instructions are drawn into.
+    BLContext& ctx = page_context();
 
-    context_.set_comp_op(BL_COMP_OP_SRC_COPY);
-    context_.set_fill_style(BLRgba32(0xFFFFFFFFu));
-    context_.fill_all();
-    context_.set_comp_op(BL_COMP_OP_SRC_OVER);
+    ctx.set_comp_op(BL_COMP_OP_SRC_COPY);
+    ctx.set_fill_style(BLRgba32(0xFFFFFFFFu));
+    ctx.fill_all();
+    ctx.set_comp_op(BL_COMP_OP_SRC_OVER);
   }
 
   // ---------------------------------------------------------------------------
@@ -1235,6 +1324,14 @@ namespace pdflib
 
     if (shape_[0] == 0 or shape_[1] == 0) { return; }
 
+    // glyphs may extend beyond their cell, allow for one font size
+    if (not intersects_region({instr.get_r_x0(), instr.get_r_x1(), instr.get_r_x2(), instr.get_r_x3()},
+                              {instr.get_r_y0(), instr.get_r_y1(), instr.get_r_y2(), instr.get_r_y3()},
+                              std::abs(instr.get_font_size())))
+      {
+        return;
+      }
+
     const text_geometry geom = make_text_geometry(instr);
 
     // Degenerate cell: quad_h too small to build a valid direction vector.
@@ -1556,6 +1653,13 @@ namespace pdflib
         return;
       }
 
+    if (not intersects_region({instr.get_r_x0(), instr.get_r_x1(), instr.get_r_x2(), instr.get_r_x3()},
+                              {instr.get_r_y0(), instr.get_r_y1(), instr.get_r_y2(), instr.get_r_y3()},
+                              0.0))
+      {
+        return;
+      }
+
     bitmap_quad q = {
       canvas_x(instr.get_r_x0()), canvas_y(instr.get_r_y0()),
       canvas_x(instr.get_r_x1()), canvas_y(instr.get_r_y1()),
@@ -1704,6 +1808,13 @@ namespace pdflib
 
     if (shape_[0] == 0 or shape_[1] == 0) { return; }
 
+    if (not intersects_region({instr.get_r_x0(), instr.get_r_x1(), instr.get_r_x2(), instr.get_r_x3()},
+                              {instr.get_r_y0(), instr.get_r_y1(), instr.get_r_y2(), instr.get_r_y3()},
+                              1.0))
+      {
+        return;
+      }
+
     BLPath path;
     path.move_to(canvas_x(instr.get_r_x0()), canvas_y(instr.get_r_y0()));
     path.line_to(canvas_x(instr.get_r_x1()), canvas_y(instr.get_r_y1()));
@@ -1828,6 +1939,20 @@ namespace pdflib
     const BLPath path = make_shape_path(instr, bbox);
     if (path.is_empty()) { return; }
 
+    // skip paths outside of the rendered region (bbox is in canvas
+    // coordinates), allowing for the stroke width and miter joins
+    if (has_region_)
+      {
+        const double pad = 1.0 + 0.5 * std::abs(instr.get_line_width())
+          * std::max(1.0, instr.get_miter_limit()) * std::max(scale_x_, scale_y_);
+
+        if (bbox.x + bbox.w < -pad or bbox.x > shape_[1] + pad or
+            bbox.y + bbox.h < -pad or bbox.y > shape_[0] + pad)
+          {
+            return;
+          }
+      }
+
     BLContext& ctx = page_context();
 
     bool clip_active = false;
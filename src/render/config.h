@@ -3,6 +3,7 @@
 #ifndef PDF_RENDER_CONFIG_H
 #define PDF_RENDER_CONFIG_H
 
+#include <array>
 #include <cmath>
 #include <stdexcept>
 #include <utility>
@@ -69,6 +70,23 @@ namespace pdflib
     // If only one is set the other is derived to preserve the page aspect ratio.
     int canvas_width  = -1;
     int canvas_height = -1;
+
+    // Blend2D worker threads that rasterize one page (asynchronous rendering
+    // through BLContextCreateInfo::thread_count). 0 rasterizes on the calling
+    // thread, -1 uses all hardware threads; docling_threaded_renderer instead
+    // resolves -1 per page to the workers left idle by page-level parallelism.
+    // The count is capped by the canvas size, so small pages always render
+    // synchronously (see renderer<BLEND2D>::MIN_PIXELS_PER_RENDER_THREAD).
+    int render_threads = 0;
+
+    // Page-space region {x0, y0, x1, y1} to rasterize (origin at the
+    // bottom-left of the crop box, y-up). The canvas then only covers the
+    // region, at the resolution the full page would have (scale or canvas
+    // size), and instructions outside of it are skipped. All zeros renders
+    // the full page.
+    std::array<double, 4> region = {0.0, 0.0, 0.0, 0.0};
+
+    bool has_region() const { return region[2] > region[0] and region[3] > region[1]; }
   };
 
   inline void validate_render_config(const render_config& config)
@@ -97,6 +115,16 @@ namespace pdflib
         throw std::runtime_error(
             "render_config.scale cannot be combined with canvas_width or canvas_height");
       }
+
+    if(not config.has_region() and config.region != std::array<double, 4>({0.0, 0.0, 0.0, 0.0}))
+      {
+        throw std::runtime_error("render_config.region must satisfy x0 < x1 and y0 < y1");
+      }
+
+    if(config.render_threads < -1)
+      {
+        throw std::runtime_error("render_config.render_threads must be >= 0 or -1");
+      }
   }
 
   inline std::pair<int, int> resolve_canvas_size(
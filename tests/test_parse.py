@@ -4,6 +4,7 @@ import glob
 import json
 import os
 import re
+from concurrent.futures import ThreadPoolExecutor
 from io import BytesIO
 from typing import Dict, List, Union
 
@@ -27,6 +28,7 @@ from docling_parse.pdf_parser import (
     DecodeConfig,
     DoclingPdfParser,
     PdfDocument,
+    segmented_page_from_decoder,
 )
 from tests.constants import PARSER_PAGE_RESTRICTIONS
 from tests.data_utils import PARSER_GROUNDTRUTH_DIR
@@ -876,6 +878,89 @@ def test_lazy_vs_eager_pages_identical():
         assert lazy_page.dimension == eager_page.dimension
 
 
+def test_line_cells_shared_with_sanitised_cells_identical():
+    """Verify that line-cells copied from the sanitised cells match contracted ones."""
+    filename = "tests/data/regression/font_04.pdf"
+
+    # default merge rules: the line-cells are copied from the sanitised cells
+    pdf_doc_shared = DoclingPdfParser(loglevel="fatal").load(
+        path_or_stream=filename, lazy=False
+    )
+
+    # perturbed merge rules: the line-cells are contracted from the char-cells
+    pdf_doc_contracted = DoclingPdfParser(loglevel="fatal").load(
+        path_or_stream=filename,
+        lazy=False,
+        decode_config=DecodeConfig(line_space_width_factor_for_merge=1.0 + 1.0e-12),
+    )
+
+    for page_no, shared_page in pdf_doc_shared._pages.items():
+        contracted_page = pdf_doc_contracted._pages[page_no]
+
+        assert shared_page.textline_cells == contracted_page.textline_cells
+        assert shared_page.word_cells == contracted_page.word_cells
+
+
+def test_columnar_export_identical():
+    """Verify that the columnar export yields the same pages as the per-cell one."""
+    content_config = ContentConfig()
+
+    for filename in ["tests/data/regression/font_04.pdf", "docs/dln-v1.pdf"]:
+        pdf_doc = DoclingPdfParser(loglevel="fatal").load(
+            path_or_stream=filename, lazy=True
+        )
+
+        for page_no in range(1, min(pdf_doc.number_of_pages(), 3) + 1):
+            decoder = pdf_doc._ensure_page_decoder(page_no, content_config)
+
+            page = segmented_page_from_decoder(
+                decoder, content_config=content_config, columnar=False
+            )
+            columnar_page = segmented_page_from_decoder(
+                decoder, content_config=content_config, columnar=True
+            )
+
+            assert columnar_page.char_cells == page.char_cells
+            assert columnar_page.word_cells == page.word_cells
+            assert columnar_page.textline_cells == page.textline_cells
+            assert columnar_page.shapes == page.shapes
+
+
+def test_prefetch_pages_identical():
+    """Verify that prefetched and concurrently decoded pages match sequential ones."""
+    filename = "docs/dln-v1.pdf"
+
+    parser = DoclingPdfParser(loglevel="fatal")
+
+    pdf_doc = parser.load(path_or_stream=filename, lazy=True)
+    num_pages = min(pdf_doc.number_of_pages(), 4)
+
+    pages = [pdf_doc.get_page(page_no) for page_no in range(1, num_pages + 1)]
+
+    prefetched_doc = DoclingPdfParser(loglevel="fatal").load(
+        path_or_stream=filename, lazy=True
+    )
+    prefetched_doc.prefetch_pages(list(range(1, num_pages + 1)))
+
+    for page_no, page in enumerate(pages, start=1):
+        assert prefetched_doc.get_page(page_no) == page
+
+    # get_page_decoder releases the GIL, so parsers on threads run in parallel
+    docs = [
+        DoclingPdfParser(loglevel="fatal").load(path_or_stream=filename, lazy=True)
+        for _ in range(3)
+    ]
+    with ThreadPoolExecutor(max_workers=len(docs)) as pool:
+        results = list(
+            pool.map(
+                lambda doc: [doc.get_page(k) for k in range(1, num_pages + 1)], docs
+            )
+        )
+
+    for result in results:
+        assert result == pages
+
+
 def test_get_annotations():
     """Test accessing document annotations."""
     parser = DoclingPdfParser(loglevel="fatal")
@@ -901,6 +986,35 @@ def test_get_annotations():
     pdf_doc.unload()
 
 
+def test_annotations_are_extracted_lazily():
+    """Loading extracts no annotations; each part is extracted on first use."""
+    filename = "tests/data/regression/table_of_contents_01.pdf"
+    timing_key = "extract_doc_annotations"
+
+    parser = DoclingPdfParser(loglevel="fatal")
+
+    pdf_doc = parser.load(path_or_stream=filename, lazy=True)
+    assert timing_key not in pdf_doc.get_document_timings()
+
+    # only the table of contents is extracted, not the form (nor the others)
+    assert pdf_doc.get_table_of_contents() is not None
+    assert len(pdf_doc.get_document_timings()[timing_key]) == 1
+
+    # the remaining parts (form, meta_xml, language) on the first full request
+    annotations = pdf_doc.get_annotations()
+    assert len(pdf_doc.get_document_timings()[timing_key]) == 4
+
+    # the same annotations as extracting all parts at once on a fresh document
+    eager_doc = DoclingPdfParser(loglevel="fatal").load(
+        path_or_stream=filename, lazy=True
+    )
+    assert eager_doc.get_annotations() == annotations
+    assert len(eager_doc.get_document_timings()[timing_key]) == 4
+
+    eager_doc.unload()
+    pdf_doc.unload()
+
+
 def verify_annotations_recursive(true_annots, pred_annots):
     """Recursively verify annotations match expected structure."""
     if isinstance(true_annots, dict):
@@ -1260,3 +1374,124 @@ def test_content_escalation_redecodes_page():
         "escalation must re-decode the page and surface word cells"
     )
     pdf_doc.unload()
+
+
+def test_content_escalation_after_prefetch_redecodes_page():
+    """Requesting word cells on a prefetched page must not reuse the prefetch."""
+    parser = DoclingPdfParser(loglevel="fatal")
+    pdf_doc = parser.load(
+        path_or_stream=TEXT_PDF,
+        lazy=True,
+        content_config=ContentConfig(word_cells_content_level=ContentLevel.SKIP),
+    )
+
+    # the prefetch may still be running when the page is unloaded
+    pdf_doc.prefetch_pages([1])
+
+    page_words = pdf_doc.get_page(
+        1,
+        content_config=ContentConfig(
+            word_cells_content_level=ContentLevel.COMPUTE_AND_MATERIALIZE
+        ),
+    )
+    assert len(page_words.word_cells) > 0
+    pdf_doc.unload()
+
+
+def _write_tokenizer_pdf(path) -> None:
+    """Write a one-page PDF whose content-stream exercises the tokenizer."""
+    content = b"""
+% comment with ( [ << delimiters
+/Span <</MCID 0 /Alt (a [b] c)>> BDC
+BT
+/F1 12 Tf
+72 700 Td
+(esc\\(aped\\) \\101\\102 line\\
+continued) Tj
+0 -14 Td
+[<48656C6C6F> -250 (World) 120.5 (!)] TJ
+0 -14 Td
+[(nested) [1 2] (array)] TJ
+1.5-2 0 Td
+(after repair) Tj
+ET
+EMC
+[3 2] 0 d
+BI /W 2 /H 1 /BPC 8 /CS /G ID \x00\xff EI
+10 10 m 100 10 l S
+"""
+    objects = [
+        b"<< /Type /Catalog /Pages 2 0 R >>",
+        b"<< /Type /Pages /Kids [3 0 R] /Count 1 >>",
+        b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] /Contents 4 0 R "
+        b"/Resources << /Font << /F1 << /Type /Font /Subtype /Type1 "
+        b"/BaseFont /Helvetica >> >> >> >>",
+        b"<< /Length %d >>\nstream\n%s\nendstream" % (len(content), content),
+    ]
+
+    data = bytearray(b"%PDF-1.4\n")
+    offsets = [0]
+    for idx, obj in enumerate(objects, start=1):
+        offsets.append(len(data))
+        data.extend(f"{idx} 0 obj\n".encode("ascii"))
+        data.extend(obj)
+        data.extend(b"\nendobj\n")
+
+    xref_offset = len(data)
+    data.extend(f"xref\n0 {len(objects) + 1}\n".encode("ascii"))
+    data.extend(b"0000000000 65535 f \n")
+    for offset in offsets[1:]:
+        data.extend(f"{offset:010d} 00000 n \n".encode("ascii"))
+    data.extend(
+        f"trailer\n<< /Size {len(objects) + 1} /Root 1 0 R >>\n"
+        f"startxref\n{xref_offset}\n%%EOF\n".encode("ascii")
+    )
+    path.write_bytes(data)
+
+
+def _pages_with_lexer(filename, native_content_lexer: bool, max_pages: int):
+    parser = DoclingPdfParser(loglevel="fatal")
+    pdf_doc = parser.load(
+        path_or_stream=filename,
+        lazy=True,
+        decode_config=DecodeConfig(native_content_lexer=native_content_lexer),
+    )
+
+    pages = {}
+    for page_no in range(1, min(pdf_doc.number_of_pages(), max_pages) + 1):
+        pages[page_no] = pdf_doc.get_page(page_no)
+    pdf_doc.unload()
+
+    return pages
+
+
+def test_native_lexer_matches_qpdf_tokenizer(tmp_path):
+    """The native content-stream lexer yields the same pages as QPDF's."""
+    tokenizer_pdf = tmp_path / "tokenizer.pdf"
+    _write_tokenizer_pdf(tokenizer_pdf)
+
+    filenames = [str(tokenizer_pdf)] + sorted(glob.glob(REGRESSION_FOLDER))
+
+    for filename in filenames:
+        native_pages = _pages_with_lexer(filename, True, max_pages=3)
+        qpdf_pages = _pages_with_lexer(filename, False, max_pages=3)
+
+        assert native_pages.keys() == qpdf_pages.keys()
+        for page_no, native_page in native_pages.items():
+            qpdf_page = qpdf_pages[page_no]
+
+            assert native_page.char_cells == qpdf_page.char_cells, (
+                f"{filename} page {page_no}: char cells differ"
+            )
+            assert native_page.shapes == qpdf_page.shapes, (
+                f"{filename} page {page_no}: shapes differ"
+            )
+            assert native_page.bitmap_resources == qpdf_page.bitmap_resources, (
+                f"{filename} page {page_no}: bitmaps differ"
+            )
+
+    tokenizer_page = _pages_with_lexer(str(tokenizer_pdf), True, max_pages=1)[1]
+    text = "".join(cell.text for cell in tokenizer_page.char_cells).replace(" ", "")
+    assert "esc(aped)ABlinecontinued" in text
+    assert "HelloWorld!" in text
+    assert "afterrepair" in text
@@ -3,10 +3,13 @@
 
 import glob
 import os
+import threading
+import time
+from io import BytesIO
 from pathlib import Path
 
 import pytest
-from docling_core.types.doc.base import CoordOrigin
+from docling_core.types.doc.base import BoundingBox, CoordOrigin
 from docling_core.types.doc.page import PdfPageBoundaryType, SegmentedPdfPage
 
 from docling_parse.pdf_parser import (
@@ -15,6 +18,7 @@ from docling_parse.pdf_parser import (
     DecodeConfig,
     DoclingPdfParser,
     DoclingThreadedPdfParser,
+    PageScheduling,
     ThreadedPdfParserConfig,
 )
 from tests.constants import PARSER_PAGE_RESTRICTIONS
@@ -55,7 +59,53 @@ Q
         b"/CropBox [0 0 200 200] /Contents 4 0 R >>",
         b"<< /Length %d >>\nstream\n%s\nendstream" % (len(content), content),
     ]
+    _write_pdf_objects(path, objects)
 
+
+def _write_uneven_pages_pdf(path: Path, segments_per_page: list[int]) -> None:
+    """Write a PDF whose pages only differ in the length of their content stream."""
+    num_pages = len(segments_per_page)
+    kids = b" ".join(b"%d 0 R" % (3 + 2 * idx) for idx in range(num_pages))
+
+    objects = [
+        b"<< /Type /Catalog /Pages 2 0 R >>",
+        b"<< /Type /Pages /Kids [%s] /Count %d >>" % (kids, num_pages),
+    ]
+    for idx, num_segments in enumerate(segments_per_page):
+        content = b"1 w\n" + b"".join(
+            b"10 %d m 190 %d l S\n" % (10 + i % 180, 10 + i % 180)
+            for i in range(num_segments)
+        )
+        objects.append(
+            b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 200] "
+            b"/Contents %d 0 R >>" % (4 + 2 * idx)
+        )
+        objects.append(
+            b"<< /Length %d >>\nstream\n%s\nendstream" % (len(content), content)
+        )
+    _write_pdf_objects(path, objects)
+
+
+def _write_text_pdf(path: Path, num_lines: int) -> None:
+    """Write a one-page PDF that shows `num_lines` lines of Helvetica text."""
+    lines = b"".join(
+        b"0 -12 Td (line %d of the cell capacity page) Tj\n" % idx
+        for idx in range(num_lines)
+    )
+    content = b"BT\n/F1 10 Tf\n20 780 Td\n" + lines + b"ET"
+
+    objects = [
+        b"<< /Type /Catalog /Pages 2 0 R >>",
+        b"<< /Type /Pages /Kids [3 0 R] /Count 1 >>",
+        b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 612 792] "
+        b"/Resources << /Font << /F1 5 0 R >> >> /Contents 4 0 R >>",
+        b"<< /Length %d >>\nstream\n%s\nendstream" % (len(content), content),
+        b"<< /Type /Font /Subtype /Type1 /BaseFont /Helvetica >>",
+    ]
+    _write_pdf_objects(path, objects)
+
+
+def _write_pdf_objects(path: Path, objects: list[bytes]) -> None:
     data = bytearray(b"%PDF-1.4\n")
     offsets = [0]
     for idx, obj in enumerate(objects, start=1):
@@ -275,6 +325,32 @@ def test_threaded_single_document():
     assert count == parser.page_count(key)
 
 
+def test_threaded_opens_document_once_per_worker():
+    """Each worker opens its pooled QPDF document once and reuses it for its pages."""
+    threads = 2
+
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(
+            loglevel="fatal",
+            threads=threads,
+            max_concurrent_results=4,
+            boundary_type=PdfPageBoundaryType.CROP_BOX,
+        ),
+        decode_config=_make_decode_config(),
+    )
+
+    key = parser.load(SAMPLE_PDF)
+
+    opened = 0
+    for result in parser.iterate_results():
+        assert result.success, result.error_message
+        assert result.timings.open_document_s >= 0.0
+        if result.timings.open_document_s > 0.0:
+            opened += 1
+
+    assert 1 <= opened <= min(threads, parser.page_count(key))
+
+
 def test_threaded_results_match_sequential():
     """Verify threaded results match sequential results for the same documents."""
     filenames = [SAMPLE_PDF]
@@ -430,6 +506,184 @@ def test_threaded_multiple_documents_with_different_subsets():
     assert parser.scheduled_page_count(bytes_key) == 1
 
 
+def test_threaded_load_documents_in_parallel():
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(
+            loglevel="fatal", threads=4, max_concurrent_results=8
+        ),
+        decode_config=_make_decode_config(),
+    )
+
+    with open(SAMPLE_PDF, "rb") as fr:
+        stream = BytesIO(fr.read())
+
+    keys = parser.load_documents([LARGE_SAMPLE_PDF, stream], page_numbers=[1, 2])
+    assert len(keys) == 2
+    assert parser.scheduled_page_count(keys[0]) == 2
+    assert parser.scheduled_page_count(keys[1]) == 2
+
+    pages_by_key: dict[str, list[int]] = {}
+    for result in parser.iterate_results():
+        assert result.success, result.error_message
+        pages_by_key.setdefault(result.doc_key, []).append(result.page_number)
+
+    assert {key: sorted(pages) for key, pages in pages_by_key.items()} == {
+        keys[0]: [1, 2],
+        keys[1]: [1, 2],
+    }
+
+    with pytest.raises(RuntimeError, match="Invalid page number"):
+        parser.load_documents([SAMPLE_PDF], page_numbers=[9999])
+
+
+@pytest.mark.skipif(not hasattr(os, "mkfifo"), reason="needs named pipes")
+def test_threaded_load_documents_decodes_while_loading(tmp_path):
+    # opening a named pipe blocks until it has a writer, so the last document
+    # stays loading until the test has consumed a page of the first one
+    fifo_path = tmp_path / "blocked.pdf"
+    os.mkfifo(fifo_path)
+
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(loglevel="fatal", threads=2),
+        decode_config=_make_decode_config(),
+    )
+
+    errors: list[str] = []
+
+    def _load():
+        try:
+            parser.load_documents([SAMPLE_PDF, fifo_path], page_numbers=[1])
+        except RuntimeError as exc:
+            errors.append(str(exc))
+
+    loader = threading.Thread(target=_load)
+    loader.start()
+    try:
+        deadline = time.monotonic() + 60.0
+        while not parser.has_tasks():
+            assert time.monotonic() < deadline, "the first document was not queued"
+            time.sleep(0.01)
+
+        result = parser.get_task()
+        still_loading = loader.is_alive()
+    finally:
+        # unblock the pipe: its document fails to load (it cannot be seeked)
+        with open(fifo_path, "wb"):
+            pass
+        loader.join()
+
+    assert result.success, result.error_message
+    assert (result.doc_key, result.page_number) == (f"key={Path(SAMPLE_PDF)!s}", 1)
+    assert still_loading
+
+    assert len(errors) == 1 and str(fifo_path) in errors[0]
+
+
+def test_threaded_load_documents_rejects_duplicate_keys():
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(loglevel="fatal", threads=2),
+        decode_config=_make_decode_config(),
+    )
+
+    with pytest.raises(RuntimeError, match="duplicate document key"):
+        parser.load_documents([SAMPLE_PDF, SAMPLE_PDF], page_numbers=[1])
+
+    # the first occurrence is loaded, and its pages are emitted only once
+    pages = [
+        (result.doc_key, result.page_number) for result in parser.iterate_results()
+    ]
+    assert pages == [(f"key={Path(SAMPLE_PDF)!s}", 1)]
+
+
+def test_threaded_longest_first_scheduling_emits_the_same_pages(tmp_path):
+    def _parse(scheduling: PageScheduling) -> dict[tuple[str, int], int]:
+        parser = DoclingThreadedPdfParser(
+            parser_config=ThreadedPdfParserConfig(
+                loglevel="fatal",
+                threads=2,
+                max_concurrent_results=4,
+                scheduling=scheduling,
+            ),
+            decode_config=_make_decode_config(),
+        )
+        parser.load(LARGE_SAMPLE_PDF, page_numbers=list(range(1, 9)))
+        parser.load(SAMPLE_PDF)
+
+        num_cells: dict[tuple[str, int], int] = {}
+        for result in parser.iterate_results():
+            assert result.success, result.error_message
+            num_cells[(result.doc_key, result.page_number)] = len(
+                result.get_page().char_cells
+            )
+        return num_cells
+
+    # only the order of the pages changes, not their content
+    assert _parse(PageScheduling.LONGEST_FIRST) == _parse(PageScheduling.FIFO)
+
+    # with a single worker, the pages come out in the order they are dequeued
+    pdf_path = tmp_path / "uneven_pages.pdf"
+    _write_uneven_pages_pdf(pdf_path, [10, 400, 40, 100])
+
+    def _page_order(scheduling: PageScheduling) -> list[int]:
+        parser = DoclingThreadedPdfParser(
+            parser_config=ThreadedPdfParserConfig(
+                loglevel="fatal", threads=1, scheduling=scheduling
+            ),
+            decode_config=_make_decode_config(),
+        )
+        parser.load(str(pdf_path))
+        return [result.page_number for result in parser.iterate_results()]
+
+    assert _page_order(PageScheduling.FIFO) == [1, 2, 3, 4]
+    assert _page_order(PageScheduling.LONGEST_FIRST) == [2, 4, 3, 1]
+
+
+def test_threaded_cell_capacity_follows_the_page_text(tmp_path):
+    pdf_path = tmp_path / "text.pdf"
+    _write_text_pdf(pdf_path, 60)
+
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(loglevel="fatal", threads=1),
+        decode_config=_make_decode_config(),
+    )
+    parser.load(str(pdf_path))
+
+    result = next(parser.iterate_results())
+    assert result.success, result.error_message
+
+    num_chars = len(result.get_page().char_cells)
+    assert num_chars > 1000
+
+    # memory_bytes counts the reserved capacity of the cell containers: they
+    # are sized from the text of the page (a few cells of slack each), where
+    # a fixed reservation of 1M cells alone would take over 200MB
+    assert result.memory_bytes < 8 * 1024 * num_chars
+
+
+def test_threaded_memory_budget_emits_all_pages():
+    # a budget below any single page: the workers hand over one result at a
+    # time, but never block on an empty queue
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(
+            loglevel="fatal",
+            threads=4,
+            max_concurrent_results=32,
+            max_result_bytes=1,
+        ),
+        decode_config=_make_decode_config(),
+    )
+    key = parser.load(LARGE_SAMPLE_PDF, page_numbers=list(range(1, 9)))
+
+    pages = []
+    for result in parser.iterate_results():
+        assert result.success, result.error_message
+        assert result.memory_bytes > 0
+        pages.append(result.page_number)
+
+    assert sorted(pages) == list(range(1, 9))
+    assert parser.scheduled_page_count(key) == 8
+
+
 def test_threaded_unload_after_consumption_is_idempotent():
     parser = DoclingThreadedPdfParser(
         parser_config=ThreadedPdfParserConfig(loglevel="fatal", threads=2),
@@ -459,6 +713,43 @@ def test_threaded_unload_during_active_iteration_raises():
         parser.unload(key)
 
 
+def test_threaded_admits_documents_while_running():
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(
+            loglevel="fatal",
+            threads=2,
+            max_concurrent_results=2,
+            unload_completed_documents=True,
+        ),
+        decode_config=_make_decode_config(),
+    )
+
+    first_key = parser.load(LARGE_SAMPLE_PDF, page_numbers=[1, 2, 3])
+    assert parser.has_tasks()
+    results = [parser.get_task()]
+
+    # admitted into the running pool, no drain or restart in between
+    second_key = parser.load(SAMPLE_PDF, page_numbers=[1, 2])
+    results.extend(parser.iterate_results())
+
+    pages_by_key: dict[str, list[int]] = {}
+    for result in results:
+        assert result.success, result.error_message
+        pages_by_key.setdefault(result.doc_key, []).append(result.page_number)
+
+    assert sorted(pages_by_key[first_key]) == [1, 2, 3]
+    assert sorted(pages_by_key[second_key]) == [1, 2]
+
+    # exactly one result per document closes it, and the document is unloaded
+    completed = [result.doc_key for result in results if result.document_completed]
+    assert sorted(completed) == sorted([first_key, second_key])
+    assert parser.unload(first_key) is False
+
+    # the pipeline keeps running for documents loaded after the drain
+    third_key = parser.load(SAMPLE_PDF, page_numbers=[1])
+    assert [result.doc_key for result in parser.iterate_results()] == [third_key]
+
+
 BITMAP_PDF = "tests/data/regression/annots_01.pdf"
 
 
@@ -615,3 +906,59 @@ def test_threaded_result_get_connected_shape_bounding_boxes(tmp_path: Path):
     box_tuples = {_bbox_tuple(box) for box in boxes}
     assert (120.0, 120.0, 170.0, 170.0) in box_tuples
     assert (10.0, 150.0, 20.0, 160.0) in box_tuples
+
+
+def test_threaded_result_batched_spatial_queries(tmp_path: Path):
+    result = _shape_geometry_result(tmp_path)
+
+    bboxes = [
+        BoundingBox(l=5, b=5, r=115, t=15, coord_origin=CoordOrigin.BOTTOMLEFT),
+        BoundingBox(l=125, b=125, r=165, t=165, coord_origin=CoordOrigin.BOTTOMLEFT),
+        BoundingBox(l=400, b=400, r=410, t=410, coord_origin=CoordOrigin.BOTTOMLEFT),
+    ]
+
+    mask = result.intersects_with_bboxes(bboxes=bboxes)
+    assert mask == [result.intersects_with(bbox=bbox) for bbox in bboxes]
+    assert mask[1] and not mask[2]
+
+    region = bboxes[0]
+    all_lines = {_bbox_tuple(line) for line in result.get_shape_lines()}
+    region_lines = {_bbox_tuple(line) for line in result.get_shape_lines(bbox=region)}
+
+    assert (10.0, 10.0, 110.0, 10.0) in region_lines
+    assert (10.0, 70.0, 80.0, 70.0) not in region_lines
+    assert region_lines <= all_lines
+
+
+def test_threaded_result_get_cells_in_bbox():
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(loglevel="fatal", threads=2),
+        decode_config=_make_decode_config(),
+    )
+    parser.load(SAMPLE_PDF)
+    result = _first_successful_result(parser)
+
+    page = BoundingBox(
+        l=0,
+        b=0,
+        r=result.page_width,
+        t=result.page_height,
+        coord_origin=CoordOrigin.BOTTOMLEFT,
+    )
+    top_half = BoundingBox(
+        l=0,
+        b=result.page_height / 2,
+        r=result.page_width,
+        t=result.page_height,
+        coord_origin=CoordOrigin.BOTTOMLEFT,
+    )
+
+    page_words = result.get_cells_in_bbox(bbox=page)
+    assert len(page_words) > 0
+    assert page_words == sorted(set(page_words))
+
+    intersecting, whole_page = result.get_cells_in_bboxes(bboxes=[top_half, page])
+    contained = result.get_cells_in_bbox(bbox=top_half, contained=True)
+
+    assert whole_page == page_words
+    assert set(contained) <= set(intersecting) <= set(page_words)
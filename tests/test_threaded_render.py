@@ -11,6 +11,7 @@ import pytest
 from docling_core.types.doc.base import BoundingBox, CoordOrigin
 from docling_core.types.doc.page import SegmentedPdfPage
 from PIL import Image as PILImage
+from PIL import ImageChops, ImageStat
 
 from docling_parse.pdf_parser import (
     DecodeConfig,
@@ -79,22 +80,13 @@ def _make_parser(
     )
 
 
-def _write_variable_page_size_pdf(path: Path) -> None:
-    objects = [
-        "<< /Type /Catalog /Pages 2 0 R >>",
-        "<< /Type /Pages /Count 2 /Kids [3 0 R 5 0 R] >>",
-        "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 300] /Contents 4 0 R >>",
-        "<< /Length 0 >>\nstream\n\nendstream",
-        "<< /Type /Page /Parent 2 0 R /MediaBox [0 0 400 500] /Contents 6 0 R >>",
-        "<< /Length 0 >>\nstream\n\nendstream",
-    ]
-
+def _write_pdf(path: Path, objects: list[bytes]) -> None:
     chunks = [b"%PDF-1.4\n%\xe2\xe3\xcf\xd3\n"]
     offsets = [0]
 
     for object_number, body in enumerate(objects, start=1):
         offsets.append(sum(len(chunk) for chunk in chunks))
-        chunks.append(f"{object_number} 0 obj\n{body}\nendobj\n".encode("ascii"))
+        chunks.append(b"%d 0 obj\n%s\nendobj\n" % (object_number, body))
 
     xref_offset = sum(len(chunk) for chunk in chunks)
     xref_lines = [
@@ -116,6 +108,19 @@ def _write_variable_page_size_pdf(path: Path) -> None:
     path.write_bytes(b"".join(chunks))
 
 
+def _write_variable_page_size_pdf(path: Path) -> None:
+    objects = [
+        b"<< /Type /Catalog /Pages 2 0 R >>",
+        b"<< /Type /Pages /Count 2 /Kids [3 0 R 5 0 R] >>",
+        b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 200 300] /Contents 4 0 R >>",
+        b"<< /Length 0 >>\nstream\n\nendstream",
+        b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 400 500] /Contents 6 0 R >>",
+        b"<< /Length 0 >>\nstream\n\nendstream",
+    ]
+
+    _write_pdf(path, objects)
+
+
 def test_render_single_document():
     """Render all pages of one document and verify each result is a valid RGBA image."""
     filename = SAMPLE_PDF
@@ -364,6 +369,40 @@ def test_render_config_rejects_scale_with_canvas_dimensions():
         _make_parser(render_config=render_config)
 
 
+def test_render_threads_match_synchronous_rendering():
+    """Rasterizing a large page on Blend2D worker threads gives the same image."""
+
+    def _render(render_threads: int) -> tuple[PILImage.Image, int]:
+        render_config = RenderConfig()
+        render_config.scale = 4.0
+        render_config.render_threads = render_threads
+        parser = _make_parser(threads=2, render_config=render_config)
+        parser.load(SAMPLE_PDF, page_numbers=[1])
+
+        result = next(parser.iterate_results())
+        assert result.success, result.error_message
+        return result.get_image(), result.render_threads
+
+    synchronous, synchronous_threads = _render(0)
+    assert synchronous_threads == 0
+
+    # a single page on a pool of 2 workers: the automatic choice gives the
+    # page both threads
+    for render_threads, expected_threads in [(-1, 2), (4, 4)]:
+        threaded, used_threads = _render(render_threads)
+        assert used_threads == expected_threads
+        assert threaded.size == synchronous.size
+        assert threaded.tobytes() == synchronous.tobytes()
+
+
+def test_render_config_rejects_invalid_render_threads():
+    render_config = RenderConfig()
+    render_config.render_threads = -2
+
+    with pytest.raises(ValueError):
+        _make_parser(render_config=render_config)
+
+
 def test_get_image_crops_using_page_coordinates():
     render_config = RenderConfig()
     render_config.scale = 2.0
@@ -388,6 +427,77 @@ def test_get_image_crops_using_page_coordinates():
     )
 
 
+def test_get_image_renders_only_the_cropbox_region():
+    render_config = RenderConfig()
+    render_config.scale = 1.0
+    parser = _make_parser(render_config=render_config)
+    parser.load(SAMPLE_PDF, page_numbers=[1])
+
+    result = next(parser.iterate_results())
+    assert result.success, result.error_message
+
+    cropbox = BoundingBox(
+        l=50,
+        t=40,
+        r=250,
+        b=160,
+        coord_origin=CoordOrigin.TOPLEFT,
+    )
+    region = result.get_image(scale=4.0, cropbox=cropbox)
+
+    assert region.size == (
+        round((cropbox.r - cropbox.l) * 4.0),
+        round((cropbox.b - cropbox.t) * 4.0),
+    )
+
+    full = result.get_image(scale=4.0)
+    cropped = full.crop((200, 160, 200 + region.width, 160 + region.height))
+
+    diff = ImageChops.difference(region.convert("RGB"), cropped.convert("RGB"))
+    assert max(ImageStat.Stat(diff).mean) < 4.0
+
+
+def test_get_image_crops_a_configured_region():
+    render_config = RenderConfig()
+    render_config.scale = 2.0
+    render_config.region = [50.0, 300.0, 350.0, 500.0]
+    parser = _make_parser(render_config=render_config)
+    parser.load(SAMPLE_PDF, page_numbers=[1])
+
+    result = next(parser.iterate_results())
+    assert result.success, result.error_message
+
+    # the default image only shows the region, re-renders show the page
+    assert result.get_image().size == (600, 400)
+    full = result.get_image(scale=2.0)
+    assert full.size == (
+        round(result.page_width * 2.0),
+        round(result.page_height * 2.0),
+    )
+
+    # a cropbox inside the region, with a top-left origin
+    cropbox = BoundingBox(
+        l=100,
+        t=result.page_height - 450,
+        r=200,
+        b=result.page_height - 350,
+        coord_origin=CoordOrigin.TOPLEFT,
+    )
+    cropped = result.get_image(cropbox=cropbox)
+    assert cropped.size == (200, 200)
+
+    expected = full.crop(
+        (
+            200,
+            round((result.page_height - 450) * 2.0),
+            400,
+            round((result.page_height - 350) * 2.0),
+        )
+    )
+    diff = ImageChops.difference(cropped.convert("RGB"), expected.convert("RGB"))
+    assert max(ImageStat.Stat(diff).mean) < 4.0
+
+
 def test_render_scale_config_handles_pages_with_different_sizes(tmp_path: Path):
     pdf_path = tmp_path / "variable_page_sizes.pdf"
     _write_variable_page_size_pdf(pdf_path)
@@ -408,6 +518,101 @@ def test_render_scale_config_handles_pages_with_different_sizes(tmp_path: Path):
     assert sizes_by_page[2] == (800, 1000)
 
 
+def _write_oversized_jpeg_pdf(path: Path) -> None:
+    """One page with a 512x512 JPEG drawn into a 64x64 pt box."""
+    image = PILImage.new("RGB", (512, 512))
+    image.putdata(
+        [(x // 2, y // 2, (x + y) // 4) for y in range(512) for x in range(512)]
+    )
+    jpeg = BytesIO()
+    image.save(jpeg, format="JPEG", quality=90)
+    jpeg_bytes = jpeg.getvalue()
+
+    content = b"q 64 0 0 64 18 18 cm /Im0 Do Q"
+    objects = [
+        b"<< /Type /Catalog /Pages 2 0 R >>",
+        b"<< /Type /Pages /Count 1 /Kids [3 0 R] >>",
+        b"<< /Type /Page /Parent 2 0 R /MediaBox [0 0 100 100] "
+        b"/Resources << /XObject << /Im0 5 0 R >> >> /Contents 4 0 R >>",
+        b"<< /Length %d >>\nstream\n%s\nendstream" % (len(content), content),
+        b"<< /Type /XObject /Subtype /Image /Width 512 /Height 512 "
+        b"/ColorSpace /DeviceRGB /BitsPerComponent 8 /Filter /DCTDecode "
+        b"/Length %d >>\nstream\n%s\nendstream" % (len(jpeg_bytes), jpeg_bytes),
+    ]
+
+    _write_pdf(path, objects)
+
+
+def test_memory_budget_counts_decoded_bitmap_pixels(tmp_path: Path):
+    """The decoded pixels of a scanned page count against max_result_bytes."""
+    pdf_paths = [tmp_path / "scan_a.pdf", tmp_path / "scan_b.pdf"]
+    for pdf_path in pdf_paths:
+        _write_oversized_jpeg_pdf(pdf_path)
+
+    # a budget well below the pixels of a single page
+    parser = DoclingThreadedPdfParser(
+        parser_config=ThreadedPdfParserConfig(
+            loglevel="fatal",
+            threads=2,
+            max_concurrent_results=4,
+            max_result_bytes=64 * 1024,
+        ),
+        decode_config=_make_decode_config(),
+    )
+    for pdf_path in pdf_paths:
+        parser.load(str(pdf_path))
+
+    results = list(parser.iterate_results())
+    assert len(results) == len(pdf_paths)
+    for result in results:
+        assert result.success, result.error_message
+        # 512x512 RGB pixels, decoded at the native resolution
+        assert result.memory_bytes >= 512 * 512 * 3
+
+
+def test_render_with_reduced_bitmap_decode(tmp_path: Path):
+    """An oversized JPEG is decoded at the render resolution, and renders the same."""
+    pdf_path = tmp_path / "oversized_jpeg.pdf"
+    _write_oversized_jpeg_pdf(pdf_path)
+
+    def _render(decode_config: DecodeConfig):
+        render_config = RenderConfig()
+        render_config.scale = 1.0
+        parser = DoclingThreadedPdfParser(
+            parser_config=ThreadedPdfParserConfig(
+                loglevel="fatal",
+                threads=2,
+                max_concurrent_results=4,
+                render_config=render_config,
+            ),
+            decode_config=decode_config,
+        )
+        parser.load(str(pdf_path))
+
+        result = next(parser.iterate_results())
+        assert result.success, result.error_message
+        artifacts = result._export_bitmap_artifacts()
+        assert len(artifacts) == 1
+        return result.get_image(), list(artifacts[0]["shape"])
+
+    reduced_config = _make_decode_config()
+    reduced_config.bitmap_decode_scale = 1.0
+
+    native_image, native_shape = _render(_make_decode_config())
+    reduced_image, reduced_shape = _render(reduced_config)
+
+    # 512 px drawn on 64 device pixels: the largest reduction (1/8) applies
+    assert native_shape[:2] == [512, 512]
+    assert reduced_shape[:2] == [64, 64]
+
+    assert reduced_image.size == native_image.size
+    diff = ImageChops.difference(
+        native_image.convert("RGB"), reduced_image.convert("RGB")
+    )
+    mean_abs_error = sum(ImageStat.Stat(diff).mean) / 3.0
+    assert mean_abs_error <= RENDERER_IMAGE_TOLERANCE.mean_abs_error
+
+
 def test_render_config_exposes_bbox_fit_flag():
     """RenderConfig exposes the opt-in glyph bbox fit flag."""
     render_config = RenderConfig()